@@ -2716,6 +2716,40 @@ public final class String implements Serializable, Comparable<String>, CharSeque
 		return hash;
 	}
 
+	/*[IF Sidecar19-SE]*/
+	private static int indexOfImplCompressed(byte[] value, int c, int start, int end) {
+	/*[ELSE]*/
+	private static int indexOfImplCompressed(char[] value, int c, int start, int end) {
+	/*[ENDIF]*/
+		byte b = (byte) c;
+
+		for (int i = start; i < end; ++i) {
+			if (helpers.getByteFromArrayByIndex(value, i) == b) {
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	/*[IF Sidecar19-SE]*/
+	private static int indexOfImplDecompressed(byte[] value, int c, int start, int end) {
+	/*[ELSE]*/
+	private static int indexOfImplDecompressed(char[] value, int c, int start, int end) {
+	/*[ENDIF]*/
+		for (int i = start; i < end; ++i) {
+			/*[IF Sidecar19-SE]*/
+			if (helpers.getCharFromArrayByIndex(value, i) == c) {
+			/*[ELSE]*/
+			if (value[i] == c) {
+			/*[ENDIF]*/
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
 	/**
 	 * Searches in this String for the first index of the specified character. The search for the character starts at the beginning and moves towards
 	 * the end of this String.
@@ -2768,24 +2802,10 @@ public final class String implements Serializable, Comparable<String>, CharSeque
 				// Check if the String is compressed
 				if (enableCompression && (null == compressionFlag || count >= 0)) {
 					if (c <= 255) {
-						byte b = (byte) c;
-
-						for (int i = start; i < len; ++i) {
-							if (helpers.getByteFromArrayByIndex(array, i) == b) {
-								return i;
-							}
-						}
+						return indexOfImplCompressed(array, c, start, len);
 					}
 				} else {
-					for (int i = start; i < len; ++i) {
-						/*[IF Sidecar19-SE]*/
-						if (helpers.getCharFromArrayByIndex(array, i) == c) {
-						/*[ELSE]*/
-						if (array[i] == c) {
-						/*[ENDIF]*/
-							return i;
-						}
-					}
+					return indexOfImplDecompressed(array, c, start, len);
 				}
 			} else if (c <= Character.MAX_CODE_POINT) {
 				for (int i = start; i < len; ++i) {
@@ -25,6 +25,7 @@
 
 #include "cache.h"
 #include "jitavl.h"
+#include "jithash.h"
 
 J9_DECLARE_CONSTANT_UTF8(newInstanceImplName, "newInstanceImpl");
 J9_DECLARE_CONSTANT_UTF8(newInstanceImplSig, "(Ljava/lang/Class;)Ljava/lang/Object;");
@@ -44,6 +45,8 @@ J9AVLTree * jit_allocate_artifacts(J9PortLibrary * portLibrary)
 	artifactAVLTree->flags = 0;
 	artifactAVLTree->rootNode = 0;
 	artifactAVLTree->portLibrary = OMRPORT_FROM_J9PORT(PORTLIB);
+	/* Holds the J9JITArtifactRangeIndex used by jit_artifact_search */
+	artifactAVLTree->userData = NULL;
 
 	return artifactAVLTree;
 }
@@ -51,6 +54,7 @@ J9AVLTree * jit_allocate_artifacts(J9PortLibrary * portLibrary)
 J9JITHashTable *avl_jit_artifact_insert_existing_table(J9AVLTree * tree, J9JITHashTable * hashTable)
 {
 	avl_insert(tree, (J9AVLTreeNode *) hashTable);
+	hash_jit_publish_range_index(tree);
 	return hashTable;
 }
 
@@ -29,6 +29,14 @@
 void avl_jit_artifact_free_all(J9JavaVM *javaVM, J9AVLTree *tree) {
 	PORT_ACCESS_FROM_PORT(javaVM->portLibrary);
 
+	J9JITArtifactRangeIndex *index = (J9JITArtifactRangeIndex *)tree->userData;
+
+	while (NULL != index) {
+		J9JITArtifactRangeIndex *previous = index->previous;
+		j9mem_free_memory(index);
+		index = previous;
+	}
+
 	avl_jit_artifact_free_node(PORTLIB, (J9JITHashTable *)tree->rootNode);
 	j9mem_free_memory(tree);
 }
@@ -518,4 +518,59 @@ J9JITExceptionTable** hash_jit_allocate_method_store(J9PortLibrary *portLibrary,
 	return (J9JITExceptionTable**) newStore;
 }
 
+
+static UDATA
+hash_jit_range_index_fill(J9JITHashTable *node, J9JITHashTable **tables, UDATA count)
+{
+	/* In-order walk, so that the tables are stored sorted by start address */
+	while (NULL != node) {
+		count = hash_jit_range_index_fill((J9JITHashTable *)J9JITHASHTABLE_LEFTCHILD(node), tables, count);
+		if (NULL != tables) {
+			tables[count] = node;
+		}
+		count += 1;
+		node = (J9JITHashTable *)J9JITHASHTABLE_RIGHTCHILD(node);
+	}
+	return count;
+}
+
+/**
+ * Rebuild the sorted range index of the code cache hash tables in the translation artifact
+ * tree and publish it for lock-free readers. Must be called after every insertion into the
+ * tree, by the thread which did the insertion (i.e. while holding exclusive VM access).
+ *
+ * Readers which do not hold VM access (e.g. profiling threads) may still be walking the old
+ * index, and hash tables are never removed from the tree, so the old index is chained to the
+ * new one and reclaimed only by avl_jit_artifact_free_all.
+ *
+ * @return the new index, or NULL if it could not be allocated, in which case the old index is
+ * marked stale and readers fall back to searching the tree.
+ */
+J9JITArtifactRangeIndex *
+hash_jit_publish_range_index(J9AVLTree *tree)
+{
+	J9JITArtifactRangeIndex *oldIndex = (J9JITArtifactRangeIndex *)tree->userData;
+	J9JITArtifactRangeIndex *newIndex = NULL;
+	UDATA count = hash_jit_range_index_fill((J9JITHashTable *)tree->rootNode, NULL, 0);
+	OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+
+	newIndex = (J9JITArtifactRangeIndex *) omrmem_allocate_memory(sizeof(J9JITArtifactRangeIndex) + (count * sizeof(J9JITHashTable *)), OMRMEM_CATEGORY_JIT);
+	if (NULL == newIndex) {
+		if (NULL != oldIndex) {
+			oldIndex->stale = 1;
+		}
+		return NULL;
+	}
+
+	newIndex->previous = oldIndex;
+	newIndex->stale = 0;
+	newIndex->count = hash_jit_range_index_fill((J9JITHashTable *)tree->rootNode, newIndex->tables, 0);
+
+	/* The index must be fully initialized before it can be seen by readers */
+	VM_AtomicSupport::writeBarrier();
+	tree->userData = newIndex;
+
+	return newIndex;
+}
+
 }
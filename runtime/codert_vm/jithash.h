@@ -40,6 +40,7 @@ J9JITExceptionTable** hash_jit_allocate_method_store(J9PortLibrary *portLibrary,
 J9JITExceptionTable** hash_jit_artifact_array_insert(J9PortLibrary *portLibrary, J9JITHashTable *table, J9JITExceptionTable** array, J9JITExceptionTable *dataToInsert, UDATA startPC);
 J9JITExceptionTable** hash_jit_artifact_array_remove(J9PortLibrary *portLibrary, J9JITExceptionTable** array, J9JITExceptionTable *dataToRemove);
 UDATA hash_jit_artifact_remove_range(J9PortLibrary *portLibrary, J9JITHashTable *table, J9JITExceptionTable *dataToRemove, UDATA startPC, UDATA endPC);
+J9JITArtifactRangeIndex *hash_jit_publish_range_index(J9AVLTree *tree);
 
 
 #ifdef __cplusplus
@@ -20,4 +20,5 @@
 
 JIT_PRODUCT_SOURCE_FILES+=\
     compiler/trj9/x/amd64/runtime/AMD64CompressString.asm \
+    compiler/trj9/x/amd64/runtime/AMD64CRC32.cpp \
     compiler/trj9/x/amd64/runtime/AMD64Recompilation.asm
@@ -591,6 +591,9 @@ J9::CodeGenerator::lowerTreesPreTreeTopVisit(TR::TreeTop *tt, vcount_t visitCoun
 
    TR::Node *node = tt->getNode();
 
+   if (node->getOpCodeValue() == TR::BNDCHK || node->getOpCodeValue() == TR::BNDCHKwithSpineCHK)
+      self()->comp()->incNumBoundChecksReachingCodegen();
+
    if (self()->getSupportsBDLLHardwareOverflowCheck() && node->getNumChildren() > 0 &&
        node->getFirstChild() && node->getFirstChild()->getOpCodeValue() == TR::icall &&
        node->getFirstChild()->getSymbol() &&
@@ -178,6 +178,8 @@
    java_lang_String_hashCode,
    java_lang_String_hashCodeImplCompressed,
    java_lang_String_hashCodeImplDecompressed,
+   java_lang_String_indexOfImplCompressed,
+   java_lang_String_indexOfImplDecompressed,
    java_lang_String_lastIndexOf,
 
    java_lang_String_toLowerCase,
@@ -30,6 +30,7 @@
 #include "il/symbol/StaticSymbol.hpp"
 #include "il/Node.hpp"
 #include "il/Node_inlines.hpp"                  // for getFirstChild, etc
+#include "ras/DebugCounter.hpp"
 #include "runtime/RuntimeAssumptions.hpp"
 #include "runtime/J9Profiler.hpp"
 #include "runtime/J9ValueProfiler.hpp"
@@ -929,6 +930,20 @@ J9::TreeEvaluator::evaluateLockForReservation(TR::Node *node, bool *reservingLoc
 
    if (persistentClassInfo && persistentClassInfo->isReservable())
       {
+      // Reservation only pays off while a single thread owns the lock; once the VM
+      // has seen instances of this class contended, cancelling the reservation
+      // on every hand-off costs more than the CAS it saves.
+      //
+      static const char *disableContentionCheck = feGetEnv("TR_DisableContendedMonitorCheck");
+      if (!disableContentionCheck && TR::Compiler->cls.hasContendedMonitor(comp, classPointer))
+         {
+         if (comp->getOption(TR_TraceCG))
+            traceMsg(comp, "Not reserving monitor node %p: class of %s is contended\n", node, comp->signature());
+         TR::DebugCounter::incStaticDebugCounter(comp, TR::DebugCounter::debugCounterName(comp, "lockOpts/reservation/skippedContended/(%s)", comp->signature()));
+         *normalLockPreservingReservation = true;
+         return;
+         }
+
       if (comp->getMethodHotness() >= warm)
          *reservingLock = true;
       else
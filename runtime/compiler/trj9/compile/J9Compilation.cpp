@@ -166,7 +166,10 @@ J9::Compilation::Compilation(
    _monitorAutoSymRefsInCompiledMethod(getTypedAllocator<TR::SymbolReference*>(self()->allocator())),
    _classForOSRRedefinition(m),
    _profileInfo(NULL),
-   _skippedJProfilingBlock(false)
+   _skippedJProfilingBlock(false),
+   _numBoundChecksGeneratedAtILGen(0),
+   _numBoundChecksSkippedAtILGen(0),
+   _numBoundChecksReachingCodegen(0)
    {
    _ObjectClassPointer   = fe->getClassFromSignature("Ljava/lang/Object;", 18, compilee);
    _RunnableClassPointer = fe->getClassFromSignature("Ljava/lang/Runnable;", 20, compilee);
@@ -281,6 +281,17 @@ class OMR_EXTENSIBLE Compilation : public OMR::CompilationConnector
    void setSkippedJProfilingBlock(bool b = true) { _skippedJProfilingBlock = b; }
    bool getSkippedJProfilingBlock() { return _skippedJProfilingBlock; }
 
+   // Bound check counts for -Xjit:verbose={optimizer}: checks IL generation created, checks it
+   // proved unnecessary and left out, and check nodes still present when trees are lowered.
+   // The last count includes copies made by versioning, unrolling or peeling, so it is not
+   // the number of created checks that survived optimization.
+   void incNumBoundChecksGeneratedAtILGen() { _numBoundChecksGeneratedAtILGen++; }
+   void incNumBoundChecksSkippedAtILGen() { _numBoundChecksSkippedAtILGen++; }
+   void incNumBoundChecksReachingCodegen() { _numBoundChecksReachingCodegen++; }
+   int32_t getNumBoundChecksGeneratedAtILGen() { return _numBoundChecksGeneratedAtILGen; }
+   int32_t getNumBoundChecksSkippedAtILGen() { return _numBoundChecksSkippedAtILGen; }
+   int32_t getNumBoundChecksReachingCodegen() { return _numBoundChecksReachingCodegen; }
+
    //
    bool supportsQuadOptimization();
 
@@ -352,6 +363,10 @@ private:
    TR_AccessedProfileInfo *_profileInfo;
 
    bool _skippedJProfilingBlock;
+
+   int32_t _numBoundChecksGeneratedAtILGen;
+   int32_t _numBoundChecksSkippedAtILGen;
+   int32_t _numBoundChecksReachingCodegen;
    };
 
 }
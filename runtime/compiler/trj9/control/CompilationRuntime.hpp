@@ -91,15 +91,18 @@ struct TR_SignatureCountPair
    int32_t count;
 };
 
-// Must be less than 8 because in some parts of the code (CHTable) we keep flags on a byte variable
-// Also, if this increases past 10, we need to expand the _activeThreadName and _suspendedThreadName
-// fields in TR::CompilationInfoPerThread as currently they have 1 char available for the thread number.
+// Must be at most 16 because in some parts of the code (CHTable) we keep one bit per
+// compilation thread on a 16-bit flags variable.
+// Also, if this increases past 100, we need to expand the _activeThreadName and _suspendedThreadName
+// fields in TR::CompilationInfoPerThread as currently they have 2 chars available for the thread number.
+// Only the threads that are needed are activated; the others stay suspended (see shouldActivateNewCompThread)
 //
-#define MAX_USABLE_COMP_THREADS 7
+#define MAX_USABLE_COMP_THREADS 15
+#define DEFAULT_USABLE_COMP_THREADS 7 // created on Linux when the number of CPUs does not warrant more
 #define MAX_DIAGNOSTIC_COMP_THREADS 1
 #define MAX_TOTAL_COMP_THREADS (MAX_USABLE_COMP_THREADS + MAX_DIAGNOSTIC_COMP_THREADS)
-#if (MAX_TOTAL_COMP_THREADS > 8)
-#error "MAX_TOTAL_COMP_THREADS should be less than 8"
+#if (MAX_TOTAL_COMP_THREADS > 16)
+#error "MAX_TOTAL_COMP_THREADS should be at most 16"
 #endif
 
 #ifndef J9_INVOCATION_COUNT_MASK
@@ -567,6 +570,12 @@ public:
    TR_MethodToBeCompiled *getNextMethodToBeCompiled(TR::CompilationInfoPerThread *compInfoPT, bool compThreadCameOutOfSleep, TR_CompThreadActions*);
    TR_MethodToBeCompiled *peekNextMethodToBeCompiled();
    TR_MethodToBeCompiled *getMethodQueue() { return _methodQueue; }
+   static uint8_t getMethodQueueBucket(uint16_t priority);
+   void unlinkFromMethodQueue(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry);
+   void raiseQueuedEntryPriority(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry, uint16_t priority);
+#if defined(DEBUG)
+   void verifyMethodQueueBucketTails();
+#endif
    int32_t getOverallCompCpuUtilization() const { return _overallCompCpuUtilization; } // -1 in case of error. 0 if feature is not enabled
    void setOverallCompCpuUtilization(int32_t c) { _overallCompCpuUtilization = c; }
    TR_YesNoMaybe exceedsCompCpuEntitlement() const { return _exceedsCompCpuEntitlement; }
@@ -898,6 +907,7 @@ private:
    //char *buildMethodString(TR_ResolvedMethod *method);
 
    static const size_t DLT_HASHSIZE = 123;
+   static const int32_t NUM_METHOD_QUEUE_BUCKETS = 11; // one for each level in CompilationPriority
 
    static TR::CompilationInfo * _compilationRuntime;
 
@@ -905,6 +915,7 @@ private:
    TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
    TR::CompilationInfoPerThreadBase *_compInfoForCompOnAppThread; // This is NULL for separate compilation thread
    TR_MethodToBeCompiled *_methodQueue;
+   TR_MethodToBeCompiled *_methodQueueBucketTail[NUM_METHOD_QUEUE_BUCKETS]; // last entry in _methodQueue for each priority bucket
    TR_MethodToBeCompiled *_methodPool;
    int32_t                _methodPoolSize; // shouldn't this and _methodPool be static?
 
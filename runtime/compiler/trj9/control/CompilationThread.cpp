@@ -335,11 +335,11 @@ int32_t TR::CompilationInfo::computeDynamicDumbInlinerBytecodeSizeCutoff(TR::Opt
 
 // How to read it: the queueWeight has to be over 100 to activate second comp thread
 //                 the queueWeight has to be below 10 to suspend second comp thread
-int32_t compThreadActivationThresholds[MAX_TOTAL_COMP_THREADS+1] =       {-1, 100, 200, 300, 400, 500, 600, 700, 800};
-int32_t compThreadSuspensionThresholds[MAX_TOTAL_COMP_THREADS+1] = {-1,  -1,  10,  110, 210, 310, 410, 510, 610};
+int32_t compThreadActivationThresholds[MAX_TOTAL_COMP_THREADS+1] = {-1, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200, 1300, 1400, 1500, 1600};
+int32_t compThreadSuspensionThresholds[MAX_TOTAL_COMP_THREADS+1] = {-1,  -1,  10, 110, 210, 310, 410, 510, 610, 710,  810,  910, 1010, 1110, 1210, 1310, 1410};
 
 
-int32_t compThreadActivationThresholdsonStarvation[MAX_TOTAL_COMP_THREADS + 1] = {-1, 800, 1600, 3200, 6400, 12800, 19200, 25600, 32000};
+int32_t compThreadActivationThresholdsonStarvation[MAX_TOTAL_COMP_THREADS + 1] = {-1, 800, 1600, 3200, 6400, 12800, 19200, 25600, 32000, 38400, 44800, 51200, 57600, 64000, 70400, 76800, 83200};
 
 // Examine if we need to activate a new thread
 // Must have compilation queue monitor in hand when calling this routine
@@ -356,6 +356,12 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
    // Do not activate new threads if we are ramping down
    if (getRampDownMCT())
       return TR_no;
+   // Do not activate a new thread if its scratch space could push the machine into swapping
+   bool incompleteInfo = false;
+   uint64_t freePhysicalMemoryB = computeFreePhysicalMemory(incompleteInfo);
+   if (freePhysicalMemoryB != OMRPORT_MEMINFO_NOT_AVAILABLE && !incompleteInfo &&
+       freePhysicalMemoryB < (uint64_t)TR::Options::getScratchSpaceLimit() + (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue())
+      return TR_no;
    // Do not activate if we already exceed the CPU enablement for compilation threads
    if (exceedsCompCpuEntitlement() != TR_no)
       {
@@ -719,7 +725,7 @@ TR::CompilationInfoPerThread::CompilationInfoPerThread(TR::CompilationInfo &comp
    // name the thread
    //
    // NOTE:
-   //      increasing MAX_TOTAL_COMP_THREADS past 9 requires an
+   //      increasing MAX_TOTAL_COMP_THREADS past 99 requires an
    //      increase in the length of _activeThreadName and _suspendedThreadName
 
    // constant thread name formats
@@ -736,22 +742,22 @@ TR::CompilationInfoPerThread::CompilationInfoPerThread(TR::CompilationInfo &comp
    // determine the correct name to use, and its length
    //
    // NOTE:
-   //       using sizeof(...) - 1 because the characters "%d" will be replaced by one digit;
+   //       using sizeof(...) because the characters "%d" will be replaced by up to two digits;
    //       the null character however *is* counted by sizeof
    if (isDiagnosticThread)
       {
       selectedActiveThreadName    = activeDiagnosticThreadName;
       selectedSuspendedThreadName = suspendedDiagnosticThreadName;
-      activeThreadNameLength      = sizeof(activeDiagnosticThreadName) - 1;
-      suspendedThreadNameLength   = sizeof(suspendedDiagnosticThreadName) - 1;
+      activeThreadNameLength      = sizeof(activeDiagnosticThreadName);
+      suspendedThreadNameLength   = sizeof(suspendedDiagnosticThreadName);
       _isDiagnosticThread         = true;
       }
    else
       {
       selectedActiveThreadName    = activeThreadName;
       selectedSuspendedThreadName = suspendedThreadName;
-      activeThreadNameLength      = sizeof(activeThreadName) - 1;
-      suspendedThreadNameLength   = sizeof(suspendedThreadName) - 1;
+      activeThreadNameLength      = sizeof(activeThreadName);
+      suspendedThreadNameLength   = sizeof(suspendedThreadName);
       _isDiagnosticThread         = false;
       }
 
@@ -1608,10 +1614,7 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
             }
 
          // detach from queue
-         if (prev)
-            prev->_next = cur->_next;
-         else
-            _methodQueue = cur->_next;
+         unlinkFromMethodQueue(prev, cur);
          updateCompQueueAccountingOnDequeue(cur);
          // decrease the queue weight
          decreaseQueueWeightBy(cur->_weight);
@@ -1719,10 +1722,7 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                   }
                }
             // detach from queue
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            unlinkFromMethodQueue(prev, cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
@@ -1997,7 +1997,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
    while (_methodQueue)
       {
       TR_MethodToBeCompiled * cur = _methodQueue;
-      _methodQueue = cur->_next;
+      unlinkFromMethodQueue(NULL, cur);
       updateCompQueueAccountingOnDequeue(cur);
       // decrease the queue weight
       decreaseQueueWeightBy(cur->_weight);
@@ -3976,7 +3976,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       // If the priority has increased, use the new priority
       //
       if (cur->_priority < priority)
-         cur->_priority = priority;
+         raiseQueuedEntryPriority(prev, cur, priority);
       // If the optimization level is higher, just upgrade
       // (unless the methods has excessive complexity)
       //
@@ -3991,14 +3991,9 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
                methodInfo->setNextCompileLevel(cur->_optimizationPlan->getOptLevel(), cur->_optimizationPlan->insertInstrumentation());
             }
          }
-      // If the position in the queue is still correct, just return
+      // raiseQueuedEntryPriority has already re-positioned the entry if its bucket changed
       //
-      if (!prev || prev->_priority >= cur->_priority)
-         return cur;
-
-      // Must re-position in the queue
-      //
-      prev->_next = cur->_next; // take it out of the queue
+      return cur;
       }
 
    // If method is not yet in the queue prepare the queue entry
@@ -4205,22 +4200,114 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   // The new entry goes after the last entry of its own bucket or, if that bucket is
+   // empty, after the last entry of the closest bucket with a higher priority.
+   // There are only a handful of buckets, so this is constant time regardless of
+   // how many requests are queued
+   uint8_t bucket = getMethodQueueBucket(entry->_priority);
+   entry->_queueBucket = bucket;
+   TR_MethodToBeCompiled *prev = NULL;
+   for (int32_t b = bucket; b < NUM_METHOD_QUEUE_BUCKETS && !prev; b++)
+      prev = _methodQueueBucketTail[b];
+   if (prev)
+      {
+      entry->_next = prev->_next;
+      prev->_next = entry;
+      }
+   else
       {
       entry->_next = _methodQueue;
       _methodQueue = entry;
       }
+   _methodQueueBucketTail[bucket] = entry;
+#if defined(DEBUG)
+   verifyMethodQueueBucketTails();
+#endif
+   }
+
+#if defined(DEBUG)
+//-------------------- verifyMethodQueueBucketTails -----------------------
+// Check that the method queue is ordered by bucket and that the tail of
+// every bucket is the last queued entry of that bucket. Walks the whole
+// queue, so it is only done in debug builds.
+// Must have compilationQueueMonitor in hand
+//-------------------------------------------------------------------------
+void TR::CompilationInfo::verifyMethodQueueBucketTails()
+   {
+   TR_MethodToBeCompiled *lastInBucket[NUM_METHOD_QUEUE_BUCKETS] = {};
+   uint8_t prevBucket = NUM_METHOD_QUEUE_BUCKETS - 1;
+   for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
+      {
+      TR_ASSERT(cur->_queueBucket <= prevBucket, "method queue entry %p in bucket %d follows an entry of lower bucket %d", cur, cur->_queueBucket, prevBucket);
+      prevBucket = cur->_queueBucket;
+      lastInBucket[cur->_queueBucket] = cur;
+      }
+   for (int32_t b = 0; b < NUM_METHOD_QUEUE_BUCKETS; b++)
+      TR_ASSERT(_methodQueueBucketTail[b] == lastInBucket[b], "stale tail %p for method queue bucket %d (expected %p)", _methodQueueBucketTail[b], b, lastInBucket[b]);
+   }
+#endif
+
+//------------------------ getMethodQueueBucket ---------------------------
+// Map a compilation priority to the index of its bucket in the method queue.
+// Buckets with a higher index hold higher priority requests and are placed
+// closer to the head of the queue
+//-------------------------------------------------------------------------
+uint8_t TR::CompilationInfo::getMethodQueueBucket(uint16_t priority)
+   {
+   static const uint16_t bucketLowerBound[NUM_METHOD_QUEUE_BUCKETS] =
+      {
+      CP_MIN,
+      CP_ASYNC_ABOVE_MIN,
+      CP_ASYNC_BELOW_NORMAL,
+      CP_ASYNC_NORMAL,
+      CP_ASYNC_ABOVE_NORMAL,
+      CP_ASYNC_BELOW_MAX,
+      CP_ASYNC_MAX,
+      CP_SYNC_MIN,
+      CP_SYNC_NORMAL,
+      CP_SYNC_BELOW_MAX,
+      CP_MAX
+      };
+   uint8_t bucket = 0;
+   while (bucket + 1 < NUM_METHOD_QUEUE_BUCKETS && priority >= bucketLowerBound[bucket + 1])
+      bucket++;
+   return bucket;
+   }
+
+//------------------------ unlinkFromMethodQueue --------------------------
+// Detach 'entry' from the method queue; 'prev' is the entry preceding it
+// or NULL if 'entry' is the head of the queue. Keeps the bucket tails
+// up-to-date. Must have compilationQueueMonitor in hand
+//-------------------------------------------------------------------------
+void TR::CompilationInfo::unlinkFromMethodQueue(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry)
+   {
+   TR_ASSERT(prev ? prev->_next == entry : _methodQueue == entry, "prev must precede entry in the method queue");
+   if (prev)
+      prev->_next = entry->_next;
    else
+      _methodQueue = entry->_next;
+   if (_methodQueueBucketTail[entry->_queueBucket] == entry)
+      _methodQueueBucketTail[entry->_queueBucket] = (prev && prev->_queueBucket == entry->_queueBucket) ? prev : NULL;
+#if defined(DEBUG)
+   verifyMethodQueueBucketTails();
+#endif
+   }
+
+//---------------------- raiseQueuedEntryPriority -------------------------
+// Raise the priority of 'entry', which is in the method queue after 'prev'
+// (NULL if 'entry' is the head). An entry whose bucket changes is moved to
+// the end of its new bucket, so that the queue order, the bucket tails and
+// _queueBucket all stay in agreement with _priority.
+// Must have compilationQueueMonitor in hand
+//-------------------------------------------------------------------------
+void TR::CompilationInfo::raiseQueuedEntryPriority(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry, uint16_t priority)
+   {
+   TR_ASSERT(entry->_priority < priority, "priority of queued entry %p is not being raised", entry);
+   entry->_priority = priority;
+   if (getMethodQueueBucket(priority) != entry->_queueBucket)
       {
-      for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
-         {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
-            {
-            entry->_next = prev->_next;
-            prev->_next = entry;
-            break;
-            }
-         }
+      unlinkFromMethodQueue(prev, entry);
+      queueEntry(entry);
       }
    }
 
@@ -4288,16 +4375,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
          methodInfo->setNextCompileLevel(newOptLevel, useProfiling);
 
          if (cur->_priority < priority)
-            {
-            // take the method out
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
-            // put it back at its proper place
-            cur->_priority = priority;
-            queueEntry(cur);
-            }
+            raiseQueuedEntryPriority(prev, cur, priority);
          }
       //fprintf(stderr, "Adjusting optimization plan in the queue\n");
       }
@@ -4340,25 +4418,10 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method * method, void *
 #endif
    cur->_priority = CP_ASYNC_MAX;
 
-   // take the method out
-   prev->_next = cur->_next;
-   // find insertion point
-   if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-      {
-      cur->_next = _methodQueue;
-      _methodQueue = cur;
-      // FIXME: how about the compilation lag
-      }
-   else
-      {
-      for (prev = _methodQueue; prev->_next; prev = prev->_next)
-         if (prev->_next->_priority < CP_ASYNC_MAX)
-            {
-            cur->_next = prev->_next;
-            prev->_next = cur;
-            break;
-            }
-      }
+   // take the method out and put it back after all other promoted requests
+   // FIXME: how about the compilation lag
+   unlinkFromMethodQueue(prev, cur);
+   queueEntry(cur);
    return i;
    }
 
@@ -4396,16 +4459,12 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
          {
          // Take the method out, increase its priority and insert it at the proper place
          //
+         // Even if the method is already at the top of the queue it must be
+         // requeued so that it is accounted for in the synchronous bucket
+         //
          cur->_priority = CP_SYNC_NORMAL;
-         if (prev)
-            {
-            prev->_next = cur->_next;
-            queueEntry(cur);
-            }
-         else // method already at the top of the queue
-            {
-            // Nothing to do
-            }
+         unlinkFromMethodQueue(prev, cur);
+         queueEntry(cur);
          }
       else
          {
@@ -4484,7 +4543,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
          _methodQueue->_methodIsInSharedCache == TR_yes) // very cheap relocation
          {
          m = _methodQueue;
-         _methodQueue = _methodQueue->_next;
+         unlinkFromMethodQueue(NULL, m);
          }
       // Check if we need to throttle
       else if (exceedsCompCpuEntitlement() == TR_yes &&
@@ -4503,7 +4562,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
          {
          m = _methodQueue;
-         _methodQueue = _methodQueue->_next;
+         unlinkFromMethodQueue(NULL, m);
          }
       else // scan for a cold/warm method
          {
@@ -4514,7 +4573,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                 m->_priority >= CP_SYNC_MIN ||       // sync comp
                 m->_methodIsInSharedCache == TR_yes) // very cheap relocation
                {
-               prev->_next = m->_next;
+               unlinkFromMethodQueue(prev, m);
                break;
                }
             }
@@ -5434,14 +5493,7 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread * vmThread, TR::Il
                break;
             }
          if (reqMe && reqMe->_priority<CP_ASYNC_ABOVE_NORMAL)
-            {
-            reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-            if (prevReq && prevReq->_priority<CP_ASYNC_ABOVE_NORMAL)
-               {
-               prevReq->_next = reqMe->_next;
-               queueEntry(reqMe);
-               }
-            }
+            raiseQueuedEntryPriority(prevReq, reqMe, CP_ASYNC_ABOVE_NORMAL);
          }
       }
 #endif // J9VM_JIT_DYNAMIC_LOOP_TRANSFER
@@ -9763,6 +9815,11 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(
             if (TR::Options::getVerboseOption(TR_VerboseOptimizer))
                {
                TR_VerboseLog::write(" opts=%d.%d", compiler->getLastPerformedOptIndex(), compiler->getLastPerformedOptSubIndex());
+               if (compiler->getNumBoundChecksGeneratedAtILGen() > 0 || compiler->getNumBoundChecksSkippedAtILGen() > 0)
+                  TR_VerboseLog::write(" bndchk=ilgen:%d,skipped:%d,codegen:%d",
+                     compiler->getNumBoundChecksGeneratedAtILGen(),
+                     compiler->getNumBoundChecksSkippedAtILGen(),
+                     compiler->getNumBoundChecksReachingCodegen());
                }
 
             if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance))
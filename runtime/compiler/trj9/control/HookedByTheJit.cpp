@@ -62,6 +62,7 @@
 #include "runtime/HookHelpers.hpp"
 #include "runtime/MethodMetaData.h"
 #include "runtime/RelocationRuntime.hpp"
+#include "runtime/RelocationRuntimeLogger.hpp"
 #include "runtime/asmprotos.h"
 #include "runtime/codertinit.hpp"
 #include "trj9/control/MethodToBeCompiled.hpp"
@@ -4733,6 +4734,9 @@ void JitShutdown(J9JITConfig * jitConfig)
       stopInterpreterProfiling(jitConfig);
       if (!options->getOption(TR_DisableIProfilerThread))
          iProfiler->stopIProfilerThread();
+      // Save the profiling information of methods that were never compiled
+      // so that the next run can use it for its first compilations
+      iProfiler->persistAllEntries(vmThread);
 #ifdef DEBUG
       uint32_t lockedEntries = iProfiler->releaseAllEntries();
       TR_ASSERT(lockedEntries == 0, "some entries were still locked on shutdown");
@@ -4779,6 +4783,12 @@ void JitShutdown(J9JITConfig * jitConfig)
    if (jProfiler != NULL)
       jProfiler->stop(javaVM);
 
+   if (feGetEnv("TR_PrintPersistentAllocatorStats"))
+      TR::Compiler->persistentAllocator().printStats();
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      TR_RelocationRuntimeLogger::printRelocationTotals();
+
    if (options && options->getOption(TR_DumpFinalMethodNamesAndCounts))
       {
       try
@@ -72,6 +72,7 @@ int32_t J9::Options::_relaxedCompilationLimitsSampleThreshold = 120; // normally
 int32_t J9::Options::_sampleThresholdVariationAllowance = 30;
 
 int32_t J9::Options::_maxCheckcastProfiledClassTests = 3;
+int32_t J9::Options::_maxPolymorphicProfiledTargets = 0; // multi-target profiled inlining is disabled by default
 int32_t J9::Options::_maxOnsiteCacheSlotForInstanceOf = 0; // Setting this value to zero will disable onsite cache in instanceof.
 int32_t J9::Options::_cpuEntitlementForConservativeScorching = 801; // 801 means more than 800%, i.e. 8 cpus
                                                                     // A very large number disables the feature
@@ -124,6 +125,9 @@ int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
+int32_t J9::Options::_iprofilerPersistAtShutdown = 1;
+int32_t J9::Options::_hotCodeCachePlacement = 0;
+int32_t J9::Options::_jitCacheTransparentHugePages = 0;
 #ifdef TR_HOST_64BIT
 int32_t J9::Options::_iProfilerMemoryConsumptionLimit=32*1024*1024;
 #else
@@ -739,6 +743,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"gcTrace=",           "D<nnn>\ttrace gc stack walks after gc number nnn",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, gcTraceThreshold), 0, "F%d"},
 #endif
+   {"hotCodeCachePlacement=", "O<nnn>\tIf non-zero, hot and scorching compilations are placed "
+                              "in a code cache designated for hot code",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hotCodeCachePlacement, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerAOTWarmOptLevelThreshold=", "O<nnn>\tAOT Warm Opt Level Threshold",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerAOTWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerBufferMaxPercentageToDiscard=", "O<nnn>\tpercentage of HW profiling buffers "
@@ -831,6 +838,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_IprofilerOffDivisionFactor, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerOffSubtractionFactor=", "O<nnn>\tCounts Subtraction factor when IProfiler is Off",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_IprofilerOffSubtractionFactor, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerPersistAtShutdown=", "O<nnn>\tIf non-zero, at shutdown store in the shared class cache "
+                                   "the IProfiler information of methods that do not have it stored yet",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerPersistAtShutdown, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerSamplesBeforeTurningOff=", "O<nnn>\tnumber of interpreter profiling samples "
                                 "needs to be taken after the profiling starts going off to completely turn it off. "
                                 "Specify a very large value to disable this optimization",
@@ -840,6 +850,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
 #if defined(AIXPPC)
    {"j2prof",             0, SET_JITCONFIG_RUNTIME_FLAG(J9JIT_J2PROF) },
 #endif
+   {"jitCacheTransparentHugePages=", "O<nnn>\tIf non-zero, code and data cache segments are 2MB aligned "
+                                     "and advised for transparent huge pages (Linux only)",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_jitCacheTransparentHugePages, 0, "F%d", NOT_IN_SUBSET},
    {"jProfilingEnablementSampleThreshold=", "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_jProfilingEnablementSampleThreshold, 0, "F%d", NOT_IN_SUBSET },
    {"kcaoffsets",         "I\tGenerate a header file with offset data for use with KCA", TR::Options::kcaOffsets, 0, 0, "F" },
@@ -867,6 +880,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_lowVirtualMemoryMBThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"maxCheckcastProfiledClassTests=", "R<nnn>\tnumber inlined profiled classes for profiledclass test in checkcast/instanceof",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_maxCheckcastProfiledClassTests, 0, "%d", NOT_IN_SUBSET},
+   {"maxPolymorphicProfiledTargets=", "O<nnn>\tenable multi-target inlining of up to nnn profiled receivers per call site (0 or 1 disables)",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_maxPolymorphicProfiledTargets, 0, "F%d", NOT_IN_SUBSET},
    {"maxOnsiteCacheSlotForInstanceOf=", "R<nnn>\tnumber of onsite cache slots for instanceOf",
       TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_maxOnsiteCacheSlotForInstanceOf, 0, "%d", NOT_IN_SUBSET},
    {"minSamplingPeriod=", "R<nnn>\tminimum number of milliseconds between samples for hotness",
@@ -1975,20 +1990,23 @@ J9::Options::fePostProcessJIT(void * base)
    //
    if (_numUsableCompilationThreads <= 0)
       {
+      uint32_t numOnlineCPUs = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_ONLINE);
 #ifdef LINUX
       // For linux we may want to create more threads to overcome thread
-      // starvation due to lack of priorities
+      // starvation due to lack of priorities. On large machines create
+      // enough threads to use numProc-1 of them during rampup; they are
+      // activated only when the compilation backlog warrants it
       //
       if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableRampupImprovements) &&
           !TR::Options::getAOTCmdLineOptions()->getOption(TR_DisableRampupImprovements))
-         _numUsableCompilationThreads = MAX_USABLE_COMP_THREADS;
+         _numUsableCompilationThreads = std::max(static_cast<uint32_t>(DEFAULT_USABLE_COMP_THREADS),
+                                                 numOnlineCPUs > 1 ? std::min(numOnlineCPUs - 1, static_cast<uint32_t>(MAX_USABLE_COMP_THREADS)) : 1);
 #endif // LINUX
       if (_numUsableCompilationThreads <= 0)
          {
          // Determine the number of compilation threads based on number of online processors
          // Do not create more than numProc-1 compilation threads, but at least one
          //
-         uint32_t numOnlineCPUs = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_ONLINE);
          _numUsableCompilationThreads = numOnlineCPUs > 1 ? std::min((numOnlineCPUs - 1), static_cast<uint32_t>(MAX_USABLE_COMP_THREADS)) : 1;
          _useCPUsToDetermineMaxNumberOfCompThreadsToActivate = true;
          }
@@ -73,6 +73,11 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _maxCheckcastProfiledClassTests;
    static int32_t getCheckcastMaxProfiledClassTests() {return _maxCheckcastProfiledClassTests;}
 
+   // Number of profiled receivers that may be inlined at one bounded-polymorphic
+   // call site. Values below 2 keep single-target profiled inlining.
+   static int32_t _maxPolymorphicProfiledTargets;
+   static int32_t getMaxPolymorphicProfiledTargets() {return _maxPolymorphicProfiledTargets;}
+
    static int32_t _maxOnsiteCacheSlotForInstanceOf;
    /** \brief
     *     Returns the _maxOnsiteCacheSlotForInstanceOf
@@ -151,6 +156,9 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
+   static int32_t _iprofilerPersistAtShutdown; // if non-zero, persist all IProfiler entries into the SCC at shutdown
+   static int32_t _hotCodeCachePlacement; // if non-zero, place hot and scorching bodies in a designated code cache
+   static int32_t _jitCacheTransparentHugePages; // if non-zero, advise code and data cache segments for THP (Linux)
 
    static int32_t _maxIprofilingCount; // when invocation count is larger than
                                        // this value Iprofiler will not collect data
@@ -20,12 +20,14 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <algorithm>
 #include "AtomicSupport.hpp"
 #include "codegen/CodeGenerator.hpp"
 #include "control/CompilationRuntime.hpp"   // for TR::CompilationInfo
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
 #include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
 #include "control/Options.hpp"
 #include "compile/SymbolReferenceTable.hpp"
 #include "env/VMJ9.h"
@@ -265,6 +267,25 @@ J9::Recompilation::endOfCompilation()
    //
    TR::CompilationController::getCompilationStrategy()->postCompilation(_compilation->getOptimizationPlan(), self());
 
+   // Record how much code was generated per byte of bytecode (including
+   // inlined callees) so the inliner can adjust its budget for the next
+   // compilation of this method.
+   //
+   if (_methodInfo)
+      {
+      uint32_t bytecodeSize = _compilation->getCurrentMethod()->maxBytecodeIndex();
+      for (uint32_t i = 0; i < _compilation->getNumInlinedCallSites(); ++i)
+         bytecodeSize += _compilation->getInlinedResolvedMethod(i)->maxBytecodeIndex();
+
+      uint32_t codeSize = _compilation->cg()->getCodeLength();
+      if (bytecodeSize > 0 && codeSize > 0)
+         {
+         uint32_t ratio = std::min<uint32_t>((codeSize * 100) / bytecodeSize, 0xFFFF);
+         _methodInfo->setCodeSizeToBytecodeRatio((uint16_t)ratio);
+         TR_PersistentMethodInfo::updateAverageCodeSizeToBytecodeRatio(ratio);
+         }
+      }
+
    if (self()->couldBeCompiledAgain())
       {
       _bodyInfo->setCounter(_nextCounter);
@@ -540,6 +561,22 @@ J9::Recompilation::shutdown()
 
 
 
+uint32_t TR_PersistentMethodInfo::_averageCodeSizeToBytecodeRatio = 0;
+
+// Maintain an exponentially decaying average of the code size to bytecode
+// size ratio across all compilations.  Updates are racy but the value is
+// only a heuristic input for the inliner.
+//
+void
+TR_PersistentMethodInfo::updateAverageCodeSizeToBytecodeRatio(uint32_t ratio)
+   {
+   uint32_t average = _averageCodeSizeToBytecodeRatio;
+   if (average == 0)
+      _averageCodeSizeToBytecodeRatio = ratio;
+   else
+      _averageCodeSizeToBytecodeRatio = (average * 15 + ratio) / 16;
+   }
+
 TR_PersistentMethodInfo::TR_PersistentMethodInfo(TR::Compilation *comp) :
    _methodInfo((TR_OpaqueMethodBlock *)comp->getCurrentMethod()->resolvedMethodAddress()),
    _flags(0),
@@ -548,7 +585,8 @@ TR_PersistentMethodInfo::TR_PersistentMethodInfo(TR::Compilation *comp) :
    _bestProfileInfo(0),
    _optimizationPlan(0),
    _numberOfInvalidations(0),
-   _numPrexAssumptions(0)
+   _numPrexAssumptions(0),
+   _codeSizeToBytecodeRatio(0)
    {
    if (comp->getOption(TR_EnableHCR) && !comp->fej9()->isAOT_DEPRECATED_DO_NOT_USE())
       {
@@ -585,7 +623,8 @@ TR_PersistentMethodInfo::TR_PersistentMethodInfo(TR_OpaqueMethodBlock *methodInf
    _bestProfileInfo(0),
    _optimizationPlan(0),
    _numberOfInvalidations(0),
-   _numPrexAssumptions(0)
+   _numPrexAssumptions(0),
+   _codeSizeToBytecodeRatio(0)
    {
    }
 
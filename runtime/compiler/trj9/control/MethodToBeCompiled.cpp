@@ -74,6 +74,7 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _hasIncrementedNumCompThreadsCompilingHotterMethods = false;
    _weight = 0;
    _jitStateWhenQueued = UNDEFINED_STATE;
+   _queueBucket = 0;
    _entryIsCountedAsInvRequest = false;
    _GCRrequest = false;
 
@@ -112,6 +112,7 @@ struct TR_MethodToBeCompiled
    uint8_t                _weight; // Up to 256 levels of weight
    bool                   _hasIncrementedNumCompThreadsCompilingHotterMethods;
    uint8_t                _jitStateWhenQueued;
+   uint8_t                _queueBucket; // priority bucket this entry was queued in; see CompilationInfo::queueEntry
    }; // TR_MethodToBeCompiled
 
 
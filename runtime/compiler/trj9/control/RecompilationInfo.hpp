@@ -176,6 +176,15 @@ class TR_PersistentMethodInfo
    int16_t getNumPrexAssumptions() {return _numPrexAssumptions;}
    void incNumPrexAssumptions() {_numPrexAssumptions++;}
 
+   // Inlining feedback: bytes of generated code per 100 bytes of bytecode
+   // (including inlined bytecode) in the most recent compilation of this method.
+   // Zero until the method has been compiled once.
+   //
+   uint16_t getCodeSizeToBytecodeRatio() { return _codeSizeToBytecodeRatio; }
+   void setCodeSizeToBytecodeRatio(uint16_t ratio) { _codeSizeToBytecodeRatio = ratio; }
+   static uint32_t getAverageCodeSizeToBytecodeRatio() { return _averageCodeSizeToBytecodeRatio; }
+   static void updateAverageCodeSizeToBytecodeRatio(uint32_t ratio);
+
    enum
       {
       // Normally set by the previous compilation to indicate that the next
@@ -292,6 +301,9 @@ class TR_PersistentMethodInfo
    uint16_t                        _timeStamp;
    uint8_t                         _numberOfInvalidations; // how many times this method has been invalidated
    int16_t                         _numPrexAssumptions;
+   uint16_t                        _codeSizeToBytecodeRatio;
+
+   static uint32_t                 _averageCodeSizeToBytecodeRatio;
 
    TR_PersistentProfileInfo       *_bestProfileInfo;
    TR_PersistentProfileInfo       *_recentProfileInfo;
@@ -115,3 +115,12 @@ J9::CPU::getPPCSupportsLM()
   return FALSE;
 #endif
    }
+
+bool
+J9::CPU::getX86SupportsPCLMULQDQ()
+   {
+   J9ProcessorDesc   *processorDesc       = TR::Compiler->target.cpu.TO_PORTLIB_getJ9ProcessorDesc();
+   J9PortLibrary     *privatePortLibrary  = TR::Compiler->portLib;
+   BOOLEAN feature = j9sysinfo_processor_has_feature(processorDesc, J9PORT_X86_FEATURE_PCLMULQDQ);
+   return (TRUE == feature);
+   }
@@ -49,6 +49,7 @@ public:
    bool getPPCSupportsAES();
    bool getPPCSupportsTM();
    bool getPPCSupportsLM();
+   bool getX86SupportsPCLMULQDQ();
    J9ProcessorDesc *TO_PORTLIB_getJ9ProcessorDesc();
    };
 }
@@ -148,6 +148,19 @@ J9::ClassEnv::hasFinalizer(TR::Compilation *comp, TR_OpaqueClassBlock *clazz)
    return comp->fej9()->hasFinalizer(clazz);
    }
 
+/**
+ * Returns true if the VM has observed an instance of this class being locked
+ * under contention, i.e. a thread had to block or inflate the monitor.  The
+ * bit reflects the current run only, so it is not consulted for AOT code.
+ */
+bool
+J9::ClassEnv::hasContendedMonitor(TR::Compilation *comp, TR_OpaqueClassBlock *clazz)
+   {
+   if (comp->compileRelocatableCode())
+      return false;
+   return (classFlagsValue(clazz) & J9ClassHasContendedMonitor) != 0;
+   }
+
 bool
 J9::ClassEnv::isClassInitialized(TR::Compilation *comp, TR_OpaqueClassBlock *clazz)
    {
@@ -75,6 +75,7 @@ public:
    bool isClassArray(TR::Compilation *comp, TR_OpaqueClassBlock *);
    bool isClassFinal(TR::Compilation *comp, TR_OpaqueClassBlock *);
    bool hasFinalizer(TR::Compilation *comp, TR_OpaqueClassBlock *classPointer);
+   bool hasContendedMonitor(TR::Compilation *comp, TR_OpaqueClassBlock *classPointer);
    bool isClassInitialized(TR::Compilation *comp, TR_OpaqueClassBlock *);
    bool hasFinalFieldsInClass(TR::Compilation *comp, TR_OpaqueClassBlock *classPointer);
    bool sameClassLoaders(TR::Compilation *comp, TR_OpaqueClassBlock *, TR_OpaqueClassBlock *);
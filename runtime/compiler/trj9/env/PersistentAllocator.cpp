@@ -21,8 +21,10 @@
  *******************************************************************************/
 
 #include "env/PersistentAllocator.hpp"
+#include <stdio.h>
 #include "il/DataTypes.hpp"
 #include "infra/Monitor.hpp"
+#include "AtomicSupport.hpp"
 
 extern TR::Monitor *memoryAllocMonitor;
 
@@ -32,6 +34,9 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
    _minimumSegmentSize(creationKit.minimumSegmentSize),
    _segmentAllocator(MEMORY_TYPE_JIT_PERSISTENT, creationKit.javaVM),
    _freeBlocks(),
+   _pendingFreeBlocks(NULL),
+   _allocationsPerBucket(),
+   _reusedBlocksPerBucket(),
    _segments(SegmentContainerAllocator(RawAllocator(&creationKit.javaVM)))
    {
    }
@@ -77,10 +82,14 @@ PersistentAllocator::allocateLocked(size_t requestedSize)
 
    TR::AllocatedMemoryMeter::update_allocated(allocSize, persistentAlloc);
 
+   if (_pendingFreeBlocks)
+      freePendingBlocks();
+
    // If this is a small block try to allocate it from the appropriate
    // fixed-size-block chain.
    //
    size_t const index = freeBlocksIndex(allocSize);
+   _allocationsPerBucket[index]++;
    Block * block = 0;
    Block * prev = 0;
    for (
@@ -108,6 +117,10 @@ PersistentAllocator::allocateLocked(size_t requestedSize)
          _freeBlocks[index] = block->next();
 
       block->_next = NULL;
+#if defined(DEBUG)
+      block->_freed = 0;
+#endif
+      _reusedBlocksPerBucket[index]++;
 
       size_t const excess = block->_size - allocSize;
 
@@ -169,6 +182,9 @@ PersistentAllocator::freeBlock(Block * block)
    TR_ASSERT(block->_size > 0, "Block size is non-positive");
    TR_ASSERT(block->_next == NULL, "In-use persistent memory block @ belongs to a free block chain.", block);
    block->_next = NULL;
+#if defined(DEBUG)
+   block->_freed = 1;
+#endif
 
    // If this is a small block, add it to the appropriate fixed-size-block
    // chain. Otherwise add it to the variable-size-block chain which is in
@@ -193,20 +209,109 @@ PersistentAllocator::freeBlock(Block * block)
       }
    }
 
+void
+PersistentAllocator::freePendingBlocks()
+   {
+   // Detach the whole pending list; concurrent deallocations start a new one
+   //
+   Block * block = _pendingFreeBlocks;
+   Block * oldHead = NULL;
+   do
+      {
+      oldHead = block;
+      block = (Block *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&_pendingFreeBlocks, (uintptr_t)oldHead, (uintptr_t)NULL);
+      }
+   while (block != oldHead);
+
+   while (block)
+      {
+      Block * next = block->_next;
+      block->_next = NULL;
+
+      // adjust the used persistent memory here and not in freePersistentmemory(block, size)
+      // because that call is also used to free memory that wasn't actually committed
+      TR::AllocatedMemoryMeter::update_freed(block->_size, persistentAlloc);
+
+      freeBlock(block);
+      block = next;
+      }
+   }
+
 void
 PersistentAllocator::deallocate(void * mem, size_t) throw()
+   {
+   Block * block = static_cast<Block *>(mem) - 1;
+
+#if defined(DEBUG)
+   TR_ASSERT(!block->_freed, "Persistent memory block %p freed twice", block);
+   block->_freed = 1;
+#endif
+
+   // Push the block on the pending list without taking the allocation monitor;
+   // it is put on its free list by the next allocation
+   //
+   Block * oldHead = _pendingFreeBlocks;
+   Block * currentHead = NULL;
+   do
+      {
+      block->_next = oldHead;
+      currentHead = (Block *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&_pendingFreeBlocks, (uintptr_t)oldHead, (uintptr_t)block);
+      if (currentHead == oldHead)
+         break;
+      oldHead = currentHead;
+      }
+   while (true);
+   }
+
+void
+PersistentAllocator::printStats() throw()
    {
    if (::memoryAllocMonitor)
       ::memoryAllocMonitor->enter();
 
+   if (_pendingFreeBlocks)
+      freePendingBlocks();
 
-   Block * block = static_cast<Block *>(mem) - 1;
+   size_t segmentBytes = 0;
+   size_t usedSegmentBytes = 0;
+   for (auto i = _segments.begin(); i != _segments.end(); ++i)
+      {
+      J9MemorySegment &segment = *i;
+      segmentBytes += segment.heapTop - segment.heapBase;
+      usedSegmentBytes += segment.heapAlloc - segment.heapBase;
+      }
+
+   printf("Persistent allocator: %llu segments, %llu KB reserved, %llu KB carved\n",
+      (unsigned long long)_segments.size(), (unsigned long long)(segmentBytes >> 10), (unsigned long long)(usedSegmentBytes >> 10));
+   printf("  class     size   allocations       reused   free blocks   free bytes\n");
+
+   size_t totalFreeBytes = 0;
+   for (size_t index = 0; index < PERSISTANT_BLOCK_SIZE_BUCKETS; ++index)
+      {
+      size_t freeBlocks = 0;
+      size_t freeBytes = 0;
+      for (Block * block = _freeBlocks[index]; block; block = block->next())
+         {
+         freeBlocks++;
+         freeBytes += block->_size;
+         }
+      totalFreeBytes += freeBytes;
 
-   // adjust the used persistent memory here and not in freePersistentmemory(block, size)
-   // because that call is also used to free memory that wasn't actually committed
-   TR::AllocatedMemoryMeter::update_freed(block->_size, persistentAlloc);
+      if (index == 0)
+         printf("  %5s %8s", "var", "-");
+      else
+         printf("  %5llu %8llu", (unsigned long long)index, (unsigned long long)(sizeof(Block) + index * sizeof(void *)));
+      printf(" %13llu %12llu %13llu %12llu\n",
+         (unsigned long long)_allocationsPerBucket[index],
+         (unsigned long long)_reusedBlocksPerBucket[index],
+         (unsigned long long)freeBlocks,
+         (unsigned long long)freeBytes);
+      }
 
-   freeBlock(block);
+   // Fragmentation: share of the carved memory sitting unused on free lists
+   printf("  free list bytes %llu (%.2f%% of carved)\n",
+      (unsigned long long)totalFreeBytes,
+      usedSegmentBytes ? (100.0 * totalFreeBytes) / usedSegmentBytes : 0.0);
 
    if (::memoryAllocMonitor)
       ::memoryAllocMonitor->exit();
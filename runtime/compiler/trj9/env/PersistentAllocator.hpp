@@ -53,6 +53,10 @@ public:
    void *allocate(size_t size, void * hint = 0);
    void deallocate(void * p, size_t sizeHint = 0) throw();
 
+   // Print per-size-class usage and free list fragmentation
+   //
+   void printStats() throw();
+
    friend bool operator ==(const PersistentAllocator &left, const PersistentAllocator &right)
       {
       return &left == &right;
@@ -70,8 +74,19 @@ private:
       {
       size_t _size;
       Block * _next;
-
-      explicit Block(size_t size, Block * next = 0) : _size(size), _next(next) {}
+#if defined(DEBUG)
+      // Non-zero while the block is on the pending or a free list, so that a
+      // double free is caught before the push links the block into a cycle
+      //
+      uintptr_t _freed;
+#endif
+
+      explicit Block(size_t size, Block * next = 0) : _size(size), _next(next)
+         {
+#if defined(DEBUG)
+         _freed = 0;
+#endif
+         }
       Block * next() { return reinterpret_cast<Block *>( (reinterpret_cast<uintptr_t>(_next) & ~0x1)); }
       };
 
@@ -87,6 +102,7 @@ private:
 
    void * allocateLocked(size_t);
    void freeBlock(Block *);
+   void freePendingBlocks();
 
    J9MemorySegment * findUsableSegment(size_t requiredSize);
 
@@ -96,6 +112,17 @@ private:
    size_t const _minimumSegmentSize;
    SegmentAllocator _segmentAllocator;
    Block * _freeBlocks[PERSISTANT_BLOCK_SIZE_BUCKETS];
+
+   // Blocks returned by deallocate without taking the allocation monitor. They are
+   // moved to _freeBlocks by the next allocation, which detaches the whole list at
+   // once so that pushing threads can never observe a recycled head (no ABA).
+   //
+   Block * volatile _pendingFreeBlocks;
+
+   // Statistics, only updated while holding the allocation monitor
+   //
+   size_t _allocationsPerBucket[PERSISTANT_BLOCK_SIZE_BUCKETS];
+   size_t _reusedBlocksPerBucket[PERSISTANT_BLOCK_SIZE_BUCKETS];
    typedef TR::typed_allocator<TR::reference_wrapper<J9MemorySegment>, TR::RawAllocator> SegmentContainerAllocator;
    typedef std::deque<TR::reference_wrapper<J9MemorySegment>, SegmentContainerAllocator> SegmentContainer;
    SegmentContainer _segments;
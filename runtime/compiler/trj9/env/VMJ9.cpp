@@ -3132,6 +3132,11 @@ bool TR_J9VMBase::supressInliningRecognizedInitialCallee(TR_CallSite* callsite,
                   }
             }
             break;
+         case TR::java_lang_String_indexOfImplCompressed:
+         case TR::java_lang_String_indexOfImplDecompressed:
+            if (TR::Compiler->target.cpu.isX86() && !TR::Compiler->om.canGenerateArraylets())
+               dontInlineRecognizedMethod = true;
+            break;
          default:
             break;
          }
@@ -5541,13 +5546,23 @@ TR_J9VMBase::setHasFailedCodeCacheAllocation()
 TR::CodeCache *
 TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    {
-   int32_t numReserved;
+   int32_t numReserved = 0;
    int32_t compThreadID = comp ? comp->getCompThreadID() : -1;
 
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   TR::CodeCache * result = NULL;
+
+   // Keep bodies that sampling has promoted to hot or scorching together in a designated
+   // code cache, which reserveCodeCache keeps warm and cold compilations out of for as long
+   // as other caches are available. Profiling bodies are short lived, so they are left out.
+   if (comp && TR::Options::_hotCodeCachePlacement &&
+       comp->getMethodHotness() >= hot && !comp->isProfilingCompilation())
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID);
+
+   if (!result)
+      result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
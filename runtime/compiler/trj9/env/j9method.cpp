@@ -2960,6 +2960,10 @@ TR_ResolvedJ9Method::TR_ResolvedJ9Method(TR_OpaqueMethodBlock * aMethod, TR_Fron
       {x(TR::java_lang_String_hashCodeImplCompressed,  "hashCodeImplCompressed",          "([CII)I")},
       {x(TR::java_lang_String_hashCodeImplDecompressed,"hashCodeImplDecompressed",        "([BII)I")},
       {x(TR::java_lang_String_hashCodeImplDecompressed,"hashCodeImplDecompressed",        "([CII)I")},
+      {x(TR::java_lang_String_indexOfImplCompressed,   "indexOfImplCompressed",           "([BIII)I")},
+      {x(TR::java_lang_String_indexOfImplCompressed,   "indexOfImplCompressed",           "([CIII)I")},
+      {x(TR::java_lang_String_indexOfImplDecompressed, "indexOfImplDecompressed",         "([BIII)I")},
+      {x(TR::java_lang_String_indexOfImplDecompressed, "indexOfImplDecompressed",         "([CIII)I")},
       {x(TR::java_lang_String_compareTo,           "compareTo",           "(Ljava/lang/String;)I")},
       {x(TR::java_lang_String_lastIndexOf,         "lastIndexOf",         "(Ljava/lang/String;I)I")},
       {x(TR::java_lang_String_toLowerCase,         "toLowerCase",         "(Ljava/util/Locale;)Ljava/lang/String;")},
@@ -4828,6 +4832,8 @@ TR_ResolvedJ9Method::setRecognizedMethodInfo(TR::RecognizedMethod rm)
             case TR::java_lang_Object_hashCodeImpl:
             case TR::java_lang_String_hashCodeImplCompressed:
             case TR::java_lang_String_hashCodeImplDecompressed:
+            case TR::java_lang_String_indexOfImplCompressed:
+            case TR::java_lang_String_indexOfImplDecompressed:
             case TR::java_util_concurrent_atomic_AtomicMarkableReference_doubleWordCAS:
             case TR::java_util_concurrent_atomic_AtomicMarkableReference_doubleWordSet:
             case TR::java_util_concurrent_atomic_AtomicMarkableReference_doubleWordCASSupported:
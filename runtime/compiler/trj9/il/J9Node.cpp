@@ -332,6 +332,28 @@ J9::Node::processJNICall(TR::TreeTop * callNodeTreeTop, TR::ResolvedMethodSymbol
       self()->setPreparedForDirectJNI();
       return self();
       }
+#elif defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+   // Direct call to the PCLMULQDQ folding routine; it expects the address of the first
+   // array element rather than the array object itself
+   //
+   if (((methodSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateBytes) ||
+        (methodSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateByteBuffer)) &&
+       !comp->requiresSpineChecks() &&
+       !comp->compileRelocatableCode() &&
+       TR::Compiler->target.cpu.getX86SupportsPCLMULQDQ())
+      {
+      if (methodSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateBytes)
+         {
+         TR::Node *arrayNode = self()->getChild(1);
+         TR::Node *firstElementNode = TR::Node::create(TR::aladd, 2,
+               arrayNode,
+               TR::Node::lconst(arrayNode, TR::Compiler->om.contiguousArrayHeaderSizeInBytes()));
+         arrayNode->decReferenceCount();
+         self()->setAndIncChild(1, firstElementNode);
+         }
+      self()->setPreparedForDirectJNI();
+      return self();
+      }
 #endif
 
    // In the latest round of VM drops, we've lowered the maximum outgoing argument size on the C stack to 32
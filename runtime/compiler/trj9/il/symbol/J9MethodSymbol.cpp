@@ -195,6 +195,8 @@ static TR::RecognizedMethod canSkipNullChecks[] =
    TR::java_lang_String_charAtInternal_IB,
    TR::java_lang_String_hashCodeImplCompressed,
    TR::java_lang_String_hashCodeImplDecompressed,
+   TR::java_lang_String_indexOfImplCompressed,
+   TR::java_lang_String_indexOfImplDecompressed,
    TR::java_lang_String_length,
    TR::java_lang_String_lengthInternal,
    //TR::java_lang_String_toLowerCase,
@@ -274,6 +276,8 @@ static TR::RecognizedMethod canSkipBoundChecks[] =
    TR::java_lang_String_compareToIgnoreCase,
    TR::java_lang_String_hashCodeImplCompressed,
    TR::java_lang_String_hashCodeImplDecompressed,
+   TR::java_lang_String_indexOfImplCompressed,
+   TR::java_lang_String_indexOfImplDecompressed,
    TR::java_lang_String_unsafeCharAt,
    TR::java_lang_String_split_str_int,
    TR::java_util_Hashtable_get,
@@ -2984,12 +2984,13 @@ TR_J9ByteCodeIlGenerator::genArrayBoundsCheck(TR::Node * offset, int32_t width)
          arrayLength = TR::Node::create(TR::iconst, 0, firstDimension);
          }
 
+      TR::Node *checkNode;
       if (comp()->requiresSpineChecks() && !_suppressSpineChecks)
          {
          // Create an incomplete check node that will be populated when all the children
          // are known.  It must be created here to be sure it is anchored in the right spot.
          //
-         TR::Node *checkNode = TR::Node::createWithSymRef(TR::BNDCHKwithSpineCHK, 4, 2, arrayLength, offset,
+         checkNode = TR::Node::createWithSymRef(TR::BNDCHKwithSpineCHK, 4, 2, arrayLength, offset,
             symRefTab()->findOrCreateArrayBoundsCheckSymbolRef(_methodSymbol));
 
          genTreeTop(checkNode);
@@ -2998,12 +2999,18 @@ TR_J9ByteCodeIlGenerator::genArrayBoundsCheck(TR::Node * offset, int32_t width)
          }
       else
          {
-         genTreeTop(TR::Node::createWithSymRef(TR::BNDCHK, 2, 2, arrayLength, offset,
-                         symRefTab()->findOrCreateArrayBoundsCheckSymbolRef(_methodSymbol)));
+         checkNode = TR::Node::createWithSymRef(TR::BNDCHK, 2, 2, arrayLength, offset,
+                         symRefTab()->findOrCreateArrayBoundsCheckSymbolRef(_methodSymbol));
+         genTreeTop(checkNode);
          }
+
+      if (!comp()->isPeekingMethod())
+         comp()->incNumBoundChecksGeneratedAtILGen();
       }
    else
       {
+      if (canSkipThisBoundCheck && !_methodSymbol->skipBoundChecks() && !comp()->isPeekingMethod())
+         comp()->incNumBoundChecksSkippedAtILGen();
 
       offset->setIsNonNegative(true);
 
@@ -29,6 +29,7 @@
 #include <algorithm>                           // for std::max, etc
 #include <stdint.h>                            // for int32_t, etc
 #include <stdio.h>                             // for NULL, printf, etc
+#include <stdlib.h>                            // for atoi
 #include <string.h>                            // for strncmp, memset, etc
 #include "codegen/CodeGenerator.hpp"           // for CodeGenerator
 #include "codegen/FrontEnd.hpp"                // for TR_FrontEnd, etc
@@ -85,6 +86,7 @@
 #include "optimizer/TransformUtil.hpp"         // for TransformUtil
 #include "optimizer/DataFlowAnalysis.hpp"
 #include "optimizer/UseDefInfo.hpp"            // for TR_UseDefInfo, etc
+#include "ras/DebugCounter.hpp"
 #include "optimizer/ValueNumberInfo.hpp"
 #include "optimizer/LocalOpts.hpp"
 #include "optimizer/MonitorElimination.hpp"
@@ -1095,6 +1097,7 @@ int32_t TR_EscapeAnalysis::performAnalysisOnce()
 
    int32_t nonContiguousAllocations = 0;
    int32_t tempsCreatedForColdEscapePoints = 0;
+   int32_t stackAllocations = 0;
 
    // Now fix up the new nodes themselves and insert any initialization code
    // that is necessary.
@@ -1145,12 +1148,23 @@ int32_t TR_EscapeAnalysis::performAnalysisOnce()
             if (candidate->_seenFieldStore)
                _repeatAnalysis = true;
 
-
+            stackAllocations++;
             _somethingChanged = true;
             }
          }
       }
 
+   if (stackAllocations > 0)
+      {
+      if (trace())
+         traceMsg(comp(), "Stack allocated %d candidate(s), %d heapified at cold or rare escape points, in %s\n",
+                  stackAllocations, tempsCreatedForColdEscapePoints, comp()->signature());
+
+      TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "escapeAnalysis/stackAllocated/(%s)", comp()->signature()), stackAllocations);
+      if (tempsCreatedForColdEscapePoints > 0)
+         TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "escapeAnalysis/heapifiedAtColdEscape/(%s)", comp()->signature()), tempsCreatedForColdEscapePoints);
+      }
+
    _somethingChanged |= devirtualizeCallSites();
 
    // If there are any call sites to be inlined, do it now
@@ -1628,13 +1642,36 @@ Candidate *TR_EscapeAnalysis::createCandidateIfValid(TR::Node *node, TR_OpaqueCl
 bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    {
    static const char *disableColdEsc = feGetEnv("TR_DisableColdEscape");
-   if (!disableColdEsc &&
-       (_inColdBlock ||
-        (candidate->isInsideALoop() &&
-         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency()))) &&
-       (candidate->_origKind == TR::New))
+   if (disableColdEsc || (candidate->_origKind != TR::New))
+      return false;
+
+   if (_inColdBlock ||
+       (candidate->isInsideALoop() &&
+        (candidate->_block->getFrequency() > 4*_curBlock->getFrequency())))
       return true;
 
+   // Outside of loops, treat the escape as cold if profiling says the escaping
+   // block runs much less often than the allocation.  The object is then stack
+   // allocated on the hot path and heapified just before the rare escape.
+   //
+   static const char *rareEscRatioStr = feGetEnv("TR_RareEscapeFrequencyRatio");
+   static int32_t rareEscRatio = rareEscRatioStr ? atoi(rareEscRatioStr) : 20;
+   if (rareEscRatio <= 0)
+      return false;
+
+   int32_t allocFrequency = candidate->_block->getFrequency();
+   int32_t escapeFrequency = _curBlock->getFrequency();
+   if (allocFrequency > (MAX_COLD_BLOCK_COUNT+1) &&
+       escapeFrequency >= 0 &&
+       escapeFrequency != (MAX_COLD_BLOCK_COUNT+1) &&
+       allocFrequency > rareEscRatio*escapeFrequency)
+      {
+      if (trace())
+         traceMsg(comp(), "   Escape point [%p] of candidate [%p] is rare (frequency %d vs %d)\n",
+                  node, candidate->_node, escapeFrequency, allocFrequency);
+      return true;
+      }
+
    return false;
    }
 
@@ -496,6 +496,214 @@ TR_J9InlinerPolicy::createUnsafeAddressWithOffset(TR::Node * unsafeCall)
    return TR::Node::create(TR::aiadd, 2, unsafeCall->getChild(1), TR::Node::create(TR::iand, 2, TR::Node::create(TR::l2i, 1, unsafeCall->getChild(2)), TR::Node::iconst(unsafeCall, ~(J9_SUN_FIELD_OFFSET_MASK))));
    }
 
+/**
+ * An Unsafe get/put whose base object is the null constant addresses native memory
+ * directly with the offset.  No null, array, or java/lang/Class tests are needed, so
+ * the access can be generated in place without splitting the block.  Keeping
+ * consecutive off-heap accesses in one block lets local CSE common the address
+ * arithmetic and lets sequential store simplification merge them into wider accesses.
+ */
+static bool
+isOffHeapUnsafeBase(TR::Node *base)
+   {
+   return base->getOpCodeValue() == TR::aconst && base->getAddress() == 0;
+   }
+
+bool
+TR_J9InlinerPolicy::createUnsafeGetPutOffHeap(TR::ResolvedMethodSymbol *calleeSymbol, TR::TreeTop *callNodeTreeTop, TR::Node *unsafeCall, TR::DataType type, bool isVolatile, bool isUnsafeGet)
+   {
+   static char *disableOffHeapSpecialization = feGetEnv("TR_DisableUnsafeOffHeapSpecialization");
+   if (disableOffHeapSpecialization)
+      return false;
+
+   // Object references are never stored off-heap
+   if (type == TR::Address)
+      return false;
+
+   bool unsignedType = false;
+   if (isUnsafeGet && comp()->fe()->dataTypeForLoadOrStore(type) != type)
+      {
+      switch (calleeSymbol->getRecognizedMethod())
+         {
+         case TR::sun_misc_Unsafe_getBoolean_jlObjectJ_Z:
+         case TR::sun_misc_Unsafe_getBooleanVolatile_jlObjectJ_Z:
+         case TR::sun_misc_Unsafe_getChar_jlObjectJ_C:
+         case TR::sun_misc_Unsafe_getCharVolatile_jlObjectJ_C:
+            unsignedType = true;
+            break;
+         case TR::sun_misc_Unsafe_getByte_jlObjectJ_B:
+         case TR::sun_misc_Unsafe_getByteVolatile_jlObjectJ_B:
+         case TR::sun_misc_Unsafe_getShort_jlObjectJ_S:
+         case TR::sun_misc_Unsafe_getShortVolatile_jlObjectJ_S:
+            break;
+         default:
+            return false;
+         }
+      }
+
+   if (!isOffHeapUnsafeBase(unsafeCall->getChild(1)))
+      return createUnsafeGetPutOffHeapGuard(callNodeTreeTop, unsafeCall, type, isVolatile, isUnsafeGet, unsignedType);
+
+   if (!performTransformation(comp(), "O^O INLINER: Generating off-heap %s for unsafe call %p with null base\n", isUnsafeGet ? "load" : "store", unsafeCall))
+      return false;
+
+   lowerUnsafeGetPutOffHeap(callNodeTreeTop, unsafeCall, type, isVolatile, isUnsafeGet, unsignedType);
+
+   TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "unsafe.offHeap/%s/(%s)", isUnsafeGet ? "get" : "put", comp()->signature()));
+   return true;
+   }
+
+/**
+ * A base that is not the null constant may still be null on every execution, as with
+ * buffer code that keeps a null base for direct memory.  Profiling compilations value
+ * profile such bases.  When a later compilation sees the base was almost always null,
+ * the call is split on a null test of the base: the fall-through path is the in-place
+ * off-heap access and the cold taken path keeps the original call.
+ */
+bool
+TR_J9InlinerPolicy::createUnsafeGetPutOffHeapGuard(TR::TreeTop *callNodeTreeTop, TR::Node *unsafeCall, TR::DataType type, bool isVolatile, bool isUnsafeGet, bool unsignedType)
+   {
+   static const float offHeapBaseProbabilityThreshold = 0.95f;
+
+   TR::Node *base = unsafeCall->getChild(1);
+   if (!base->getOpCode().isLoadVar() || base->isNonNull() || base->getByteCodeInfo().doNotProfile() ||
+       callNodeTreeTop->getEnclosingBlock()->isCold())
+      return false;
+
+   if (comp()->isProfilingCompilation())
+      {
+      TR::Recompilation *recomp = comp()->getRecompilationInfo();
+      TR_ValueProfiler *valueProfiler = recomp ? recomp->getValueProfiler() : NULL;
+      if (valueProfiler)
+         valueProfiler->addProfilingTrees(base, callNodeTreeTop->getPrevTreeTop(), 0, AddressInfo, LinkedListProfiler);
+      return false;
+      }
+
+   TR_AddressInfo *valueInfo = static_cast<TR_AddressInfo*>(TR_ValueProfileInfoManager::getProfiledValueInfo(base, comp(), AddressInfo));
+   if (!valueInfo || valueInfo->getTotalFrequency() == 0 || valueInfo->getTopValue() != 0 ||
+       valueInfo->getTopProbability() < offHeapBaseProbabilityThreshold)
+      return false;
+
+   if (!performTransformation(comp(), "O^O INLINER: Generating off-heap %s for unsafe call %p guarded by profiled null base\n", isUnsafeGet ? "load" : "store", unsafeCall))
+      return false;
+
+   TR_ASSERT(unsafeCall == callNodeTreeTop->getNode()->getFirstChild(), "assumption not valid\n");
+
+   createTempsForUnsafeCall(callNodeTreeTop, unsafeCall);
+
+   TR::Node *compareNode = TR::Node::createif(TR::ifacmpne, unsafeCall->getChild(1)->duplicateTree(), TR::Node::aconst(unsafeCall, 0), NULL);
+   TR::TreeTop *compareTree = TR::TreeTop::create(comp(), compareNode);
+
+   TR::TreeTop *ifTree = TR::TreeTop::create(comp(), callNodeTreeTop->getNode()->duplicateTree());
+   ifTree->getNode()->getFirstChild()->setVisitCount(_inliner->getVisitCount());
+
+   TR::TreeTop *elseTree = TR::TreeTop::create(comp(), callNodeTreeTop->getNode()->duplicateTree());
+   TR::Node *offHeapCall = elseTree->getNode()->getFirstChild();
+   offHeapCall->getChild(1)->recursivelyDecReferenceCount();
+   offHeapCall->setAndIncChild(1, TR::Node::aconst(offHeapCall, 0));
+   lowerUnsafeGetPutOffHeap(elseTree, offHeapCall, type, isVolatile, isUnsafeGet, unsignedType);
+   elseTree->getNode()->getFirstChild()->setVisitCount(_inliner->getVisitCount());
+
+   // the call itself may be commoned, so we need to create a temp for the callnode itself
+   TR::SymbolReference *newSymbolReference = NULL;
+   TR::DataType dataType = unsafeCall->getDataType();
+   if (unsafeCall->getReferenceCount() > 1)
+      {
+      newSymbolReference = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), dataType);
+      TR::Node::recreate(unsafeCall, comp()->il.opCodeForDirectLoad(dataType));
+      unsafeCall->setSymbolReference(newSymbolReference);
+      unsafeCall->removeAllChildren();
+      }
+
+   TR::Block *callBlock = callNodeTreeTop->getEnclosingBlock();
+   callBlock->createConditionalBlocksBeforeTree(callNodeTreeTop, compareTree, ifTree, elseTree, comp()->getFlowGraph(), false);
+
+   if (newSymbolReference)
+      {
+      ifTree->insertAfter(TR::TreeTop::create(comp(), TR::Node::createWithSymRef(comp()->il.opCodeForDirectStore(dataType), 1, 1, ifTree->getNode()->getFirstChild(), newSymbolReference)));
+      elseTree->insertAfter(TR::TreeTop::create(comp(), TR::Node::createWithSymRef(comp()->il.opCodeForDirectStore(dataType), 1, 1, elseTree->getNode()->getFirstChild(), newSymbolReference)));
+      }
+
+   if (comp()->getOption(TR_TraceUnsafeInlining))
+      traceMsg(comp(), "\tGenerated null base guard %p for off-heap %s at unsafe call %p, base null probability %.2f\n", compareNode, isUnsafeGet ? "load" : "store", unsafeCall, valueInfo->getTopProbability());
+
+   TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "unsafe.offHeap/%s/guarded/(%s)", isUnsafeGet ? "get" : "put", comp()->signature()));
+   return true;
+   }
+
+/**
+ * Replace an Unsafe get/put with a null base by a single load or store at the offset
+ * address, in place under callNodeTreeTop.
+ */
+void
+TR_J9InlinerPolicy::lowerUnsafeGetPutOffHeap(TR::TreeTop *callNodeTreeTop, TR::Node *unsafeCall, TR::DataType type, bool isVolatile, bool isUnsafeGet, bool unsignedType)
+   {
+   bool conversionNeeded = comp()->fe()->dataTypeForLoadOrStore(type) != type;
+   TR::Node *base = unsafeCall->getChild(1);
+   TR::Node *offset = unsafeCall->getChild(2);
+   TR::Node *address = NULL;
+   if (TR::Compiler->target.is64Bit())
+      address = TR::Node::create(TR::aladd, 2, base, offset);
+   else
+      address = TR::Node::create(TR::aiadd, 2, base, TR::Node::create(TR::l2i, 1, offset));
+
+   TR::SymbolReference *symRef = comp()->getSymRefTab()->findOrCreateUnsafeSymbolRef(type, true, false, isVolatile);
+
+   if (isUnsafeGet)
+      {
+      TR::Node *load = NULL;
+      if (conversionNeeded)
+         {
+         load = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectArrayLoad(type), 1, 1, address, symRef);
+         load->incReferenceCount();
+         }
+      else
+         {
+         address->incReferenceCount();
+         }
+
+      for (int32_t j = 0; j < unsafeCall->getNumChildren(); j++)
+         unsafeCall->getChild(j)->recursivelyDecReferenceCount();
+      unsafeCall->setNumChildren(1);
+
+      if (conversionNeeded)
+         {
+         TR::Node::recreate(unsafeCall, TR::ILOpCode::getProperConversion(type, comp()->fe()->dataTypeForLoadOrStore(type), unsignedType));
+         unsafeCall->setChild(0, load);
+         }
+      else
+         {
+         TR::Node::recreate(unsafeCall, comp()->il.opCodeForIndirectLoad(type));
+         unsafeCall->setSymbolReference(symRef);
+         unsafeCall->setChild(0, address);
+         }
+
+      TR::Node::recreate(callNodeTreeTop->getNode(), TR::treetop);
+      }
+   else
+      {
+      TR::Node *value = unsafeCall->getChild(3);
+      switch (type)
+         {
+         case TR::Int8:
+            value = TR::Node::create(TR::i2b, 1, value);
+            break;
+         case TR::Int16:
+            value = TR::Node::create(TR::i2s, 1, value);
+            break;
+         default:
+            break;
+         }
+
+      TR::Node *store = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectArrayStore(type), 2, 2, address, value, symRef);
+      callNodeTreeTop->setNode(store);
+      unsafeCall->recursivelyDecReferenceCount();
+      }
+
+   if (comp()->getOption(TR_TraceUnsafeInlining))
+      traceMsg(comp(), "\tGenerated off-heap %s for unsafe call %p without base object tests\n", isUnsafeGet ? "load" : "store", unsafeCall);
+   }
+
 void
 TR_J9InlinerPolicy::createTempsForUnsafeCall( TR::TreeTop *callNodeTreeTop, TR::Node * unsafeCallNode )
    {
@@ -1064,6 +1272,9 @@ TR_J9InlinerPolicy::createUnsafePutWithOffset(TR::ResolvedMethodSymbol *calleeSy
    if(comp()->getOption(TR_TraceUnsafeInlining))
        traceMsg(comp(),"\tcreateUnsafePutWithOffset.  offset(datatype) %d isvolatile %d needNullCheck %d isOrdered %d\n",type.getDataType(),isVolatile,needNullCheck,isOrdered);
 
+   if (!isOrdered && createUnsafeGetPutOffHeap(calleeSymbol, callNodeTreeTop, unsafeCall, type, isVolatile, false))
+      return true;
+
 
    TR::SymbolReference * symRef = comp()->getSymRefTab()->findOrCreateUnsafeSymbolRef(type, true, false, isVolatile);
    if (isOrdered)
@@ -1412,6 +1623,9 @@ TR_J9InlinerPolicy::createUnsafeGetWithOffset(TR::ResolvedMethodSymbol *calleeSy
    if (debug("traceUnsafe"))
       printf("createUnsafeGetWithOffset %s in %s\n", type.toString(), comp()->signature());
 
+   if (createUnsafeGetPutOffHeap(calleeSymbol, callNodeTreeTop, unsafeCall, type, isVolatile, true))
+      return true;
+
    TR::Node *unsafeAddress = unsafeCall->getChild(1);
    TR::Node *offset = unsafeCall->getChild(2);
 
@@ -2486,12 +2700,9 @@ int32_t TR_Inliner::perform()
    {
    //static bool enableInliningInOSR = feGetEnv("TR_disableInliningInOSR") != NULL;
 
-  //Disabled, but putting in here an env option to enable it for testing
-  //this is not the best spot but the other didn't work out
-  //and it's temporary anyways
-  static const char* enableMT4Testing = feGetEnv("TR_EnableMT4Testing");
-
-  if (!enableMT4Testing)
+   // Multi-target profiled inlining is only enabled with -Xjit:maxPolymorphicProfiledTargets=<n>, n > 1
+   //
+   if (TR::Options::getMaxPolymorphicProfiledTargets() < 2)
       comp()->setOption(TR_DisableMultiTargetInlining);
 
 
@@ -3411,7 +3622,10 @@ bool TR_MultipleCallTargetInliner::inlineCallTargets(TR::ResolvedMethodSymbol *c
       for (; calltarget; calltarget = calltarget->getNext())
          {
          if (calltarget)
+            {
             calltarget->_myCallSite->removecalltarget(calltarget,tracer(),Trimmed_List_of_Callees);
+            reportInliningDecision(calltarget, false, "exceeds caller weight budget");
+            }
          }
       if (comp()->getOption(TR_TraceAll) || tracer()->heuristicLevel())
          {
@@ -3453,7 +3667,10 @@ bool TR_MultipleCallTargetInliner::inlineCallTargets(TR::ResolvedMethodSymbol *c
       for(; calltarget; calltarget = calltarget->getNext())
          {
          if(calltarget)
+            {
             calltarget->_myCallSite->removecalltarget(calltarget,tracer(),Trimmed_List_of_Callees);
+            reportInliningDecision(calltarget, false, "exceeds node count budget");
+            }
          }
       if (comp()->getOption(TR_TraceAll) || tracer()->heuristicLevel())
          {
@@ -3531,6 +3748,7 @@ bool TR_MultipleCallTargetInliner::inlineCallTargets(TR::ResolvedMethodSymbol *c
                   TR::TreeTop* oldTt = tt;
                   bool success = inlineCallTarget(&callStack, calltarget, true, NULL, &tt);
                   anySuccess |= success;
+                  reportInliningDecision(calltarget, success, success ? "inlined" : "failed during transformation");
                   debugTrace(tracer(), "(Second Iteration) call target %p node %p.  success = %d anySuccess = %d",calltarget, oldTt->getNode(),success,anySuccess);
                   }
                }
@@ -3549,6 +3767,20 @@ bool TR_MultipleCallTargetInliner::inlineCallTargets(TR::ResolvedMethodSymbol *c
    return anySuccess;
    }
 
+void TR_MultipleCallTargetInliner::reportInliningDecision(TR_CallTarget *calltarget, bool inlined, const char *reason)
+   {
+   TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "inliner.decision/%s/(%s)", inlined ? "inlined" : "rejected", reason));
+
+   if (comp()->trace(OMR::inlining) || tracer()->heuristicLevel())
+      traceMsg(comp(), "Inlining decision: %s %s [size %d weight %d] in %s: %s\n",
+               inlined ? "INLINED " : "REJECTED",
+               tracer()->traceSignature(calltarget->_calleeSymbol),
+               calltarget->_size,
+               calltarget->_weight,
+               comp()->signature(),
+               reason);
+   }
+
 void TR_MultipleCallTargetInliner::weighCallSite( TR_CallStack * callStack , TR_CallSite *callsite, bool currentBlockHasExceptionSuccessors, bool dontAddCalls)
    {
    TR_J9InlinerPolicy *j9inlinerPolicy = (TR_J9InlinerPolicy *) getPolicy();
@@ -4625,6 +4857,34 @@ TR_J9InlinerUtil::refineInliningThresholds(TR::Compilation *comp, int32_t &calle
    {
    comp->fej9()->setInlineThresholds(comp, callerWeightLimit, maxRecursiveCallByteCodeSizeEstimate, methodByteCodeSizeThreshold,
          methodInWarmBlockByteCodeSizeThreshold, methodInColdBlockByteCodeSizeThreshold, nodeCountThreshold, size);
+
+   // Scale the budget by how the previous compilation of this method compared with the
+   // average amount of code generated per byte of bytecode.  Methods whose inlined
+   // bodies expanded more than usual get a smaller budget, and vice versa.
+   //
+   static const char *disableInlinerFeedback = feGetEnv("TR_DisableInlinerSizeFeedback");
+   TR_PersistentMethodInfo *methodInfo = TR_PersistentMethodInfo::get(comp);
+   uint32_t average = TR_PersistentMethodInfo::getAverageCodeSizeToBytecodeRatio();
+   if (!disableInlinerFeedback && methodInfo && methodInfo->getCodeSizeToBytecodeRatio() > 0 && average > 0)
+      {
+      uint32_t ratio = methodInfo->getCodeSizeToBytecodeRatio();
+
+      // Clamp the adjustment to [1/2, 5/4] of the default budget
+      //
+      int32_t scale = (int32_t)((average * 100) / ratio);
+      scale = std::max(50, std::min(125, scale));
+      if (scale != 100)
+         {
+         callerWeightLimit = (callerWeightLimit * scale) / 100;
+         maxRecursiveCallByteCodeSizeEstimate = (maxRecursiveCallByteCodeSizeEstimate * scale) / 100;
+
+         if (comp->trace(OMR::inlining))
+            traceMsg(comp, "Inliner size feedback: last code/bytecode ratio %u%%, average %u%%, scaling budget to %d%%: callerWeightLimit %d maxRecursiveCallByteCodeSizeEstimate %d\n",
+                     ratio, average, scale, callerWeightLimit, maxRecursiveCallByteCodeSizeEstimate);
+
+         TR::DebugCounter::incStaticDebugCounter(comp, TR::DebugCounter::debugCounterName(comp, "inliner.budget/%s", scale < 100 ? "reduced" : "increased"));
+         }
+      }
    }
 
 bool
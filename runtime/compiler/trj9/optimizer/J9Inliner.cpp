@@ -51,6 +51,14 @@
 
 #define OPT_DETAILS "O^O INLINER: "
 
+// A call site whose most frequent receivers together account for at least
+// POLYMORPHIC_MIN_COVERAGE of the profile is treated as bounded-polymorphic:
+// each of those receivers may be inlined behind its own profiled guard as
+// long as it is seen at least POLYMORPHIC_MIN_CALL_FREQUENCY of the time.
+// The number of receivers is set with -Xjit:maxPolymorphicProfiledTargets=<n>.
+#define POLYMORPHIC_MIN_COVERAGE       .90f
+#define POLYMORPHIC_MIN_CALL_FREQUENCY .03f
+
 extern int32_t          *NumInlinedMethods;  // Defined in Inliner.cpp
 extern int32_t          *InlinedSizes;       // Defined in Inliner.cpp
 
@@ -806,6 +814,28 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
    bool firstInstanceOfCheckFailed = false;
    int32_t totalFrequency = valueInfo->getTotalFrequency();
 
+   int32_t const maxPolymorphicTargets = TR::Options::getMaxPolymorphicProfiledTargets();
+
+   // Determine whether the receivers that fit in a type switch cover almost all of the
+   // profile. If they do, less frequent receivers are still worth a guarded inline.
+   //
+   bool isBoundedPolymorphic = false;
+   if (!comp()->getOption(TR_DisableMultiTargetInlining) && totalFrequency > 0)
+      {
+      uint32_t coveredFrequency = 0;
+      int32_t numReceivers = 0;
+      for (TR_ExtraAddressInfo *profiledInfo = sortedValuesIt.getFirst(); profiledInfo != NULL && numReceivers < maxPolymorphicTargets; profiledInfo = sortedValuesIt.getNext(), numReceivers++)
+         coveredFrequency += profiledInfo->_frequency;
+
+      isBoundedPolymorphic = numReceivers > 1 && ((float)coveredFrequency / (float)totalFrequency) >= POLYMORPHIC_MIN_COVERAGE;
+
+      if (isBoundedPolymorphic && comp()->trace(OMR::inlining))
+         traceMsg(comp(), "inliner: %d profiled receivers cover %f%% of call site %p, considering polymorphic inlining\n",
+                  numReceivers, (float)coveredFrequency * 100.0f / (float)totalFrequency, this);
+      }
+
+   int32_t numProfiledTargets = 0;
+
 
    for (TR_ExtraAddressInfo *profiledInfo = sortedValuesIt.getFirst(); profiledInfo != NULL; profiledInfo = sortedValuesIt.getNext())
       {
@@ -840,8 +870,16 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
       static const float minProfiledCallFrequency = userMinProfiledCallFreq ? atof (userMinProfiledCallFreq) :
          comp()->getOption(TR_DisableMultiTargetInlining) ? MIN_PROFILED_CALL_FREQUENCY : .10f;
 
+      if (!comp()->getOption(TR_DisableMultiTargetInlining) && numProfiledTargets >= maxPolymorphicTargets)
+         {
+         if (comp()->trace(OMR::inlining))
+            traceMsg(comp(), "bailing, reached the maximum of %d profiled targets\n", maxPolymorphicTargets);
+         break;
+         }
+
       if ((val >= minProfiledCallFrequency ||
-               (firstInstanceOfCheckFailed && val >= SECOND_BEST_MIN_CALL_FREQUENCY)) &&
+               (firstInstanceOfCheckFailed && val >= SECOND_BEST_MIN_CALL_FREQUENCY) ||
+               (isBoundedPolymorphic && val >= POLYMORPHIC_MIN_CALL_FREQUENCY)) &&
           !comp()->getPersistentInfo()->isObsoleteClass((void*)tempreceiverClass, comp()->fe()))
          {
          TR_OpaqueClassBlock* callSiteClass = _receiverClass ? _receiverClass : getClassFromMethod();
@@ -894,7 +932,8 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
 
          heuristicTrace(inliner->tracer(),"Creating a profiled call. callee Symbol %p frequencyadjustment %f",_initialCalleeSymbol, val);
          addTarget(comp()->trMemory(),inliner,guard,targetMethod,tempreceiverClass,heapAlloc,val);
-         
+         numProfiledTargets++;
+
          if (comp()->getOption(TR_DisableMultiTargetInlining))
             return;
          }
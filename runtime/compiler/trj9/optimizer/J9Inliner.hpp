@@ -98,6 +98,7 @@ class TR_MultipleCallTargetInliner : public TR_InlinerBase
 
       bool analyzeCallSite(TR::ResolvedMethodSymbol *, TR_CallStack *, TR::TreeTop *, TR::Node *, TR::Node *);
       void weighCallSite( TR_CallStack * callStack , TR_CallSite *callsite, bool currentBlockHasExceptionSuccessors,bool dontAddCalls=false);
+      void reportInliningDecision(TR_CallTarget *calltarget, bool inlined, const char *reason);
 
       int32_t applyArgumentHeuristics(TR_LinkHead<TR_ParameterMapping> &map, int32_t originalWeight, TR_CallTarget *target);
       bool eliminateTailRecursion(TR::ResolvedMethodSymbol *, TR_CallStack *, TR::TreeTop *, TR::Node *, TR::Node *, TR_VirtualGuardSelection *);
@@ -202,6 +203,9 @@ class TR_J9InlinerPolicy : public OMR_InlinerPolicy
       TR::Node *    createUnsafeAddress(TR::Node *);
       bool         createUnsafeGetWithOffset(TR::ResolvedMethodSymbol *, TR::ResolvedMethodSymbol *, TR::TreeTop *, TR::Node *, TR::DataType, bool, bool needNullCheck = false);
       TR::Node *    createUnsafeAddressWithOffset(TR::Node *);
+      bool         createUnsafeGetPutOffHeap(TR::ResolvedMethodSymbol *, TR::TreeTop *, TR::Node *, TR::DataType, bool isVolatile, bool isUnsafeGet);
+      bool         createUnsafeGetPutOffHeapGuard(TR::TreeTop *, TR::Node *, TR::DataType, bool isVolatile, bool isUnsafeGet, bool unsignedType);
+      void         lowerUnsafeGetPutOffHeap(TR::TreeTop *, TR::Node *, TR::DataType, bool isVolatile, bool isUnsafeGet, bool unsignedType);
       bool         createUnsafeFence(TR::TreeTop *, TR::Node *, TR::ILOpCodes);
 
       TR::Node *    createUnsafeMonitorOp(TR::ResolvedMethodSymbol *calleeSymbol, TR::ResolvedMethodSymbol *callerSymbol, TR::TreeTop * callNodeTreeTop, TR::Node * unsafeCall, bool isEnter);
@@ -72,6 +72,7 @@
 #include "optimizer/TransformUtil.hpp"             // for TransformUtil
 #include "optimizer/UseDefInfo.hpp"                // for TR_UseDefInfo, etc
 #include "optimizer/ValueNumberInfo.hpp"
+#include "ras/DebugCounter.hpp"
 #include "ras/LogTracer.hpp"                       // for debugTrace, etc
 
 class TR_OpaqueClassBlock;
@@ -2752,7 +2753,7 @@ void TR::MonitorElimination::coarsenMonitorRanges()
              {
              if (_monexitBlockInfo[blockNum] == lockedObjectValueNumber)
                 {
-                if ((!containsCall) && performTransformation(comp(), "%s Success: Coarsening monexit %p locally in block_%d\n", OPT_DETAILS, currentMonexit->getNode(), blockNum))
+                if ((!containsCall) && !isContendedMonitor(node) && performTransformation(comp(), "%s Success: Coarsening monexit %p locally in block_%d\n", OPT_DETAILS, currentMonexit->getNode(), blockNum))
                    {
                    _invalidateUseDefInfo = true;
                    _invalidateValueNumberInfo = true;
@@ -3022,7 +3023,8 @@ void TR::MonitorElimination::coarsenMonitorRanges()
          prevLockedObject = info->getValueNumber(prevMonitorNode->getFirstChild());
          //dumpOptDetails(comp(), "Block number %d monexit status %d prevLockedObject %d\n", blockNum, _monexitBlockInfo[blockNum], prevLockedObject);
 
-         if (_monexitBlockInfo[blockNum] < 0)
+         if (_monexitBlockInfo[blockNum] < 0 ||
+             isContendedMonitor(prevMonitorNode))
             {
             prevLockedObject = -1;
             prevMonitorNode = NULL;
@@ -5004,6 +5006,26 @@ void TR::MonitorElimination::collectSymRefsInSimpleLockedRegion(TR::Node *node,
 
 
 
+// Coarsening a monitor whose class the VM has seen contended lengthens the
+// critical section other threads are already waiting on, so leave such
+// monitors alone.
+//
+bool TR::MonitorElimination::isContendedMonitor(TR::Node *monitorNode)
+   {
+   static char *disableContentionCheck = feGetEnv("TR_DisableContendedMonitorCheck");
+   if (disableContentionCheck)
+      return false;
+
+   TR_OpaqueClassBlock *monitorClass = monitorNode->getMonitorClass(comp()->getCurrentMethod());
+   if (!monitorClass || !TR::Compiler->cls.hasContendedMonitor(comp(), monitorClass))
+      return false;
+
+   if (trace())
+      traceMsg(comp(), "Monitor node %p locks an instance of a contended class; not coarsening\n", monitorNode);
+   TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "lockOpts/coarsening/skippedContended/(%s)", comp()->signature()));
+   return true;
+   }
+
 bool TR::MonitorElimination::callsAllowCoarsening()
    {
    bool recoveryPossible = true;
@@ -229,6 +229,7 @@ class MonitorElimination : public TR::Optimization
    bool isSimpleLockedRegion(TR::TreeTop *);
    void collectSymRefsInSimpleLockedRegion(TR::Node *, vcount_t);
    bool callsAllowCoarsening();
+   bool isContendedMonitor(TR::Node *monitorNode);
    bool treesAllowCoarsening(TR::TreeTop *, TR::TreeTop *, bool *, bool *seenCheck = NULL);
    bool symbolsAreNotWritten(TR_BitVector *);
    bool symbolsAreNotWrittenInTrees(TR::TreeTop *, TR::TreeTop *);
@@ -3421,6 +3421,7 @@ TR_SPMDKernelParallelizer::perform()
 
    // vectorize after GPU transformations
    TR_HashId id = 0;
+   int32_t numVectorizedLoops = 0;
    ListIterator<TR_RegionStructure> sit(&simdLoops);
    for (TR_RegionStructure *loop = sit.getFirst(); loop; loop = sit.getNext())
       {
@@ -3429,11 +3430,18 @@ TR_SPMDKernelParallelizer::perform()
          if (reductionOperationsHashTab->locate(loop, id))
             {
             TR_HashTab* reductionHashTab = (TR_HashTab*)reductionOperationsHashTab->getData(id);
-            vectorize(comp(), loop, loop->getPrimaryInductionVariable(), reductionHashTab, 0, optimizer());
+            bool vectorized = vectorize(comp(), loop, loop->getPrimaryInductionVariable(), reductionHashTab, 0, optimizer());
+            if (vectorized)
+               numVectorizedLoops++;
+            if (trace())
+               traceMsg(comp(), "Loop %d %s\n", loop->getNumber(), vectorized ? "vectorized" : "not vectorized");
             }
          }
       }
 
+   if (trace())
+      traceMsg(comp(), "Auto-Vectorization: %d of %d collected loops vectorized in %s\n", numVectorizedLoops, simdLoops.getSize(), comp()->signature());
+
    return 1;
    }
 
@@ -4187,13 +4195,34 @@ TR_SPMDKernelParallelizer::collectParallelLoops(TR_RegionStructure *region,
    TR_HashTab* reductionHashTab = new (comp()->trStackMemory()) TR_HashTab(comp()->trMemory(), stackAlloc);
    TR_HashId id = 0;
 
-   if (isSPMDKernelLoop(region, comp()) ||
-       (!comp()->getOptions()->getOption(TR_DisableAutoSIMD) &&
-        comp()->cg()->getSupportsAutoSIMD() &&
-        isPerfectNest(region, comp()) &&
-        checkDataLocality(region, useNodesOfDefsInLoop, defsInLoop, comp(), useDefInfo, reductionHashTab) &&
-        checkIndependence(region, useDefInfo, useNodesOfDefsInLoop, defsInLoop, comp()) &&
-        checkLoopIteration(region,comp())))
+   bool collect = isSPMDKernelLoop(region, comp());
+
+   if (!collect &&
+       !comp()->getOptions()->getOption(TR_DisableAutoSIMD) &&
+       comp()->cg()->getSupportsAutoSIMD())
+      {
+      const char *rejectReason = NULL;
+      if (!isPerfectNest(region, comp()))
+         rejectReason = "not a perfect nest";
+      else if (!checkDataLocality(region, useNodesOfDefsInLoop, defsInLoop, comp(), useDefInfo, reductionHashTab))
+         rejectReason = "data locality";
+      else if (!checkIndependence(region, useDefInfo, useNodesOfDefsInLoop, defsInLoop, comp()))
+         rejectReason = "loop carried dependence";
+      else if (!checkLoopIteration(region,comp()))
+         rejectReason = "loop iteration";
+
+      if (rejectReason)
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d rejected for Auto-Vectorization: %s\n", region->getNumber(), rejectReason);
+         }
+      else
+         {
+         collect = true;
+         }
+      }
+
+   if (collect)
       {
       traceMsg(comp(), "Loop %d and piv = %d collected for Auto-Vectorization\n", region->getNumber(), region->getPrimaryInductionVariable()->getSymRef()->getReferenceNumber());
       simdLoops.add(region);
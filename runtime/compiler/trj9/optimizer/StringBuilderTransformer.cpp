@@ -23,6 +23,8 @@
 #include "optimizer/StringBuilderTransformer.hpp"
 
 #include <math.h>
+#include "control/Recompilation.hpp"
+#include "control/RecompilationInfo.hpp"
 #include "env/jittypes.h"
 #include "env/CompilerEnv.hpp"
 #include "env/VMAccessCriticalSection.hpp"
@@ -31,6 +33,8 @@
 #include "il/symbol/StaticSymbol.hpp"
 #include "optimizer/Optimization_inlines.hpp"
 #include "ras/DebugCounter.hpp"
+#include "runtime/J9Profiler.hpp"
+#include "runtime/J9ValueProfiler.hpp"
 
 #if defined (_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -141,10 +145,24 @@ int32_t TR_StringBuilderTransformer::performOnBlock(TR::Block* block)
                {
                List<TR_Pair<TR::Node*, TR::RecognizedMethod> > appendArguments (trMemory());
 
-               if (findStringBuilderChainedAppendArguments(iter, currentNode, appendArguments) != NULL)
+               TR::Node* toStringNode = findStringBuilderChainedAppendArguments(iter, currentNode, appendArguments);
+
+               if (toStringNode != NULL)
                   {
                   int32_t capacity = computeHeuristicStringBuilderInitCapacity(appendArguments);
 
+                  int32_t profiledCapacity = computeProfiledStringBuilderInitCapacity(toStringNode);
+
+                  if (profiledCapacity > capacity)
+                     {
+                     if (trace())
+                        {
+                        traceMsg(comp(), "[0x%p] Raising capacity from %d to profiled capacity %d.\n", toStringNode, capacity, profiledCapacity);
+                        }
+
+                     capacity = profiledCapacity;
+                     }
+
                   if (performTransformation(comp(), "%sTransforming java/lang/StringBuilder.<init>()V call at node [0x%p] to java/lang/StringBuilder.<init>(I)V with capacity = %d\n", OPT_DETAILS, initNode, capacity))
                      {
                      static const bool collectAppendStatistics = feGetEnv("TR_StringBuilderTransformerCollectAppendStatistics") != NULL;
@@ -195,6 +213,18 @@ int32_t TR_StringBuilderTransformer::performOnBlock(TR::Block* block)
                         }
 
                      TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "StringBuilderTransformer/Succeeded/%d/%s", capacity, comp()->signature()));
+
+                     if (comp()->isProfilingCompilation())
+                        {
+                        for (TR::TreeTop* tt = iter.currentTree(); tt != block->getExit(); tt = tt->getNextTreeTop())
+                           {
+                           if (tt->getNode()->getNumChildren() > 0 && tt->getNode()->getFirstChild() == toStringNode)
+                              {
+                              addStringBuilderLengthProfilingTrees(tt, toStringNode);
+                              break;
+                              }
+                           }
+                        }
                      }
                   }
                }
@@ -648,3 +678,107 @@ int32_t TR_StringBuilderTransformer::computeHeuristicStringBuilderInitCapacity(L
 
    return capacity;
    }
+
+/** \details
+ *     The profiled lengths are examined in ascending order and the first length for which the cumulative frequency of
+ *     all lengths not exceeding it reaches 90% of the total frequency is chosen. Lengths beyond the largest String
+ *     we are willing to pre-size for are ignored so that a handful of very long Strings cannot bloat every
+ *     StringBuilder allocated at this site.
+ */
+int32_t TR_StringBuilderTransformer::computeProfiledStringBuilderInitCapacity(TR::Node* toStringNode)
+   {
+   static const int32_t maxProfiledCapacity = 1024;
+
+   TR_ValueProfileInfoManager* profileManager = TR_ValueProfileInfoManager::get(comp());
+
+   if (profileManager == NULL)
+      {
+      return 0;
+      }
+
+   TR_ValueInfo* valueInfo = static_cast<TR_ValueInfo*>(profileManager->getValueInfo(toStringNode->getByteCodeInfo(), comp(), ValueInfo));
+
+   if (valueInfo == NULL || valueInfo->getTotalFrequency() == 0)
+      {
+      return 0;
+      }
+
+   TR_ScratchList<TR_ExtraValueInfo> valuesSortedByFrequency(comp()->trMemory());
+   valueInfo->getSortedList(comp(), &valuesSortedByFrequency);
+   ListIterator<TR_ExtraValueInfo> iter(&valuesSortedByFrequency);
+
+   uint32_t totalFrequency = valueInfo->getTotalFrequency();
+   int32_t capacity = 0;
+
+   for (TR_ExtraValueInfo* candidate = iter.getFirst(); candidate != NULL; candidate = iter.getNext())
+      {
+      int32_t length = static_cast<int32_t>(candidate->_value);
+
+      if (length <= 0 || length > maxProfiledCapacity || (capacity != 0 && length >= capacity))
+         {
+         continue;
+         }
+
+      uint32_t coveredFrequency = 0;
+
+      ListIterator<TR_ExtraValueInfo> coverageIter(&valuesSortedByFrequency);
+
+      for (TR_ExtraValueInfo* other = coverageIter.getFirst(); other != NULL; other = coverageIter.getNext())
+         {
+         if (static_cast<int32_t>(other->_value) <= length)
+            {
+            coveredFrequency += other->_frequency;
+            }
+         }
+
+      if (coveredFrequency * 10 >= totalFrequency * 9)
+         {
+         capacity = length;
+         }
+      }
+
+   if (trace() && capacity != 0)
+      {
+      traceMsg(comp(), "[0x%p] Profiled capacity = %d from %d samples.\n", toStringNode, capacity, totalFrequency);
+      }
+
+   return capacity;
+   }
+
+void TR_StringBuilderTransformer::addStringBuilderLengthProfilingTrees(TR::TreeTop* toStringTree, TR::Node* toStringNode)
+   {
+   TR::Recompilation* recomp = comp()->getRecompilationInfo();
+   TR_ValueProfiler* valueProfiler = recomp != NULL ? recomp->getValueProfiler() : NULL;
+
+   if (valueProfiler == NULL || toStringNode->getByteCodeInfo().doNotProfile())
+      {
+      return;
+      }
+
+   TR_OpaqueClassBlock* stringBuilderClass = comp()->fej9()->getClassFromSignature("Ljava/lang/StringBuilder;", 25, comp()->getCurrentMethod());
+
+   if (stringBuilderClass == NULL)
+      {
+      return;
+      }
+
+   int32_t countOffset = comp()->fej9()->getInstanceFieldOffset(stringBuilderClass, "count", 5, "I", 1);
+
+   if (countOffset == -1)
+      {
+      return;
+      }
+
+   countOffset += static_cast<int32_t>(comp()->fej9()->getObjectHeaderSizeInBytes());
+
+   if (performTransformation(comp(), "%sAdding length profiling trees after java/lang/StringBuilder.toString call at node [0x%p]\n", OPT_DETAILS, toStringNode))
+      {
+      TR::SymbolReference* countSymRef = comp()->getSymRefTab()->findOrFabricateShadowSymbol(comp()->getMethodSymbol(), TR::Symbol::Java_lang_StringBuilder_count, TR::Int32, countOffset, false, true, false, "java/lang/StringBuilder.count I");
+
+      // The sign bit of count marks an uncompressed StringBuilder when String compression is enabled
+      TR::Node* countNode = TR::Node::createWithSymRef(toStringNode, TR::iloadi, 1, toStringNode->getFirstChild(), countSymRef);
+      TR::Node* lengthNode = TR::Node::create(toStringNode, TR::iand, 2, countNode, TR::Node::iconst(toStringNode, 0x7FFFFFFF));
+
+      valueProfiler->addProfilingTrees(lengthNode, toStringTree, 10);
+      }
+   }
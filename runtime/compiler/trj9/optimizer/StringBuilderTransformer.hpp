@@ -72,6 +72,10 @@ namespace TR { class Block; }
  *     heuristically tries to estimate the sizes of the append arguments. If it can the optimization will precisely
  *     determine the sizes of all constant append arguments.
  *
+ *     In profiling compilations the length of the resulting String is value profiled at the toString call. Later
+ *     compilations use the smallest profiled length covering most observed executions as a lower bound on the
+ *     capacity, so that chains with non-constant arguments are also sized in a single allocation.
+ *
  *  \section Debug Counters
  *     You can track the locations of where this optimization succeeded or failed via the following debug counter:
  *
@@ -227,6 +231,32 @@ class TR_StringBuilderTransformer : public TR::Optimization
     *     Heuristically calculated char length of the String that is the result of a call to StringBuilder.toString().
     */
    int32_t computeHeuristicStringBuilderInitCapacity(List<TR_Pair<TR::Node*, TR::RecognizedMethod> >& appendArguments);
+
+   /** \brief
+    *     Computes the initial capacity suggested by value profiling of the length of the String produced by the
+    *     StringBuilder.toString() call terminating an append chain.
+    *
+    *  \param toStringNode
+    *     The call to StringBuilder.toString() terminating the append chain.
+    *
+    *  \return
+    *     The smallest profiled length which covers the majority of the observed lengths, or 0 if no usable profiling
+    *     information is available.
+    */
+   int32_t computeProfiledStringBuilderInitCapacity(TR::Node* toStringNode);
+
+   /** \brief
+    *     Inserts value profiling trees after a StringBuilder.toString() call to record the length of the StringBuilder
+    *     at the time it is converted to a String. The collected lengths are consumed by
+    *     computeProfiledStringBuilderInitCapacity in subsequent compilations.
+    *
+    *  \param toStringTree
+    *     The tree containing the call to StringBuilder.toString().
+    *
+    *  \param toStringNode
+    *     The call to StringBuilder.toString() terminating the append chain.
+    */
+   void addStringBuilderLengthProfilingTrees(TR::TreeTop* toStringTree, TR::Node* toStringNode);
    };
 
 #endif
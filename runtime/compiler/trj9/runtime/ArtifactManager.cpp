@@ -93,6 +93,8 @@ TR_TranslationArtifactManager::addCodeCache(TR::CodeCache *codeCache)
    if (newTable)
       {
       success = (avl_insert(_translationArtifacts, (J9AVLTreeNode *) newTable) != NULL);
+      if (success)
+         hash_jit_publish_range_index(_translationArtifacts);
       }
    return success;
    }
@@ -27,6 +27,7 @@
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/VMJ9.h"
+#include "runtime/CodeCacheManager.hpp"
 
 //--------------------- DataCacheManager ----------------
 
@@ -266,6 +267,15 @@ TR_DataCache* TR_DataCacheManager::allocateNewDataCache(uint32_t minimumSize)
                dataCache->_allocationMark = dataCacheSeg->heapAlloc;
                _numAllocatedCaches++;
                _totalSegmentMemoryAllocated += (uint32_t)allocatedSize;
+               if (TR::Options::_jitCacheTransparentHugePages)
+                  {
+                  // Data cache segments come from malloc, so only whole 2MB pages inside
+                  // the segment can be advised; segments below 4MB may get none
+                  size_t advisedSize = TR::CodeCacheManager::adviseTransparentHugePages(dataCacheSeg->heapBase, dataCacheSeg->heapTop);
+                  if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+                     TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "data cache segment %p-%p: %u bytes advised for transparent huge pages",
+                        dataCacheSeg->heapBase, dataCacheSeg->heapTop, (uint32_t)advisedSize);
+                  }
 #ifdef DATA_CACHE_DEBUG
                fprintf(stderr, "Allocated a new segment %p of size %d for TR_DataCache %p heapAlloc=%p\n",
                   dataCacheSeg, segSize, dataCache, dataCacheSeg->heapAlloc);
@@ -37,6 +37,7 @@
 #include "runtime/ArtifactManager.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/DataCache.hpp"
+#include "runtime/MethodMetaData.h"
 #include "runtime/RuntimeAssumptions.hpp"
 #include "trj9/env/VMJ9.h"
 #include "trj9/env/j9method.h"
@@ -130,7 +131,7 @@ namespace  {
       if (metaData->bodyInfo)
          {
          void * mapTable = ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->getMapTable();
-         if (mapTable && mapTable != (void *)-1)
+         if (mapTable && mapTable != (void *)-1 && !jitIsStackMapTableInMetaData(metaData, mapTable))
             {
             PORT_ACCESS_FROM_VMC(vmThread);
             j9mem_free_memory(mapTable);
@@ -176,8 +177,8 @@ namespace  {
             stubMetadata->osrInfo = NULL;
             stubMetadata->runtimeAssumptionList = NULL;
             
-            // FASTWALK
-            freeFastWalkCache(vmThread, stubMetadata);
+            // FASTWALK; the table may live in the original metadata, so check against that
+            freeFastWalkCache(vmThread, metaData);
             
             // Update J9JITExceptionTable Linked List
             updateExceptionTableLinkedList(stubMetadata);
@@ -1028,11 +1028,11 @@ TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptrj_t data,
    }
 
 TR_IPBytecodeHashTableEntry *
-TR_IProfiler::searchForSample(uintptrj_t pc, int32_t bucket)
+TR_IProfiler::searchForSample(uintptrj_t pc, TR_IPBytecodeHashTableEntry *head)
    {
    TR_IPBytecodeHashTableEntry *entry;
 
-   for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+   for (entry = head; entry; entry = entry->getNext())
       {
       if (pc == entry->getPC())
          return entry;
@@ -1062,9 +1062,11 @@ TR_IProfiler::searchForAllocSample(uintptrj_t pc, int32_t bucket)
 TR_IPBytecodeHashTableEntry *
 TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptrj_t pc, bool addIt)
    {
-   TR_IPBytecodeHashTableEntry *entry = NULL;
+   // Remember the head the search started from: anything added to the bucket
+   // after this point is in front of it and must be looked at before adding
+   TR_IPBytecodeHashTableEntry *searchedHead = _bcHashTable[bucket];
+   TR_IPBytecodeHashTableEntry *entry = searchForSample(pc, searchedHead);
 
-   entry = searchForSample (pc, bucket);
    // if we are just searching and we didn't find profile data for the
    // method just go back
    if (!addIt)
@@ -1073,28 +1075,100 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptrj_t pc, bool addIt)
    if (entry)
       return entry;
 
-   // Create a new hash table entry
+   // Create a new hash table entry. The raw allocation is kept so that the
+   // entry can be given back if another thread adds the same pc first
    U_8 byteCode = *(U_8*) pc;
+   size_t entrySize;
    if (isCompact(byteCode))
-      entry = new TR_IPBCDataFourBytes(pc);
+      entrySize = sizeof(TR_IPBCDataFourBytes);
+   else if (isSwitch(byteCode))
+      entrySize = sizeof(TR_IPBCDataEightWords);
    else
-      {
-      if (isSwitch(byteCode))
-         entry = new TR_IPBCDataEightWords(pc);
-      else
-         entry = new TR_IPBCDataCallGraph(pc);
-      }
+      entrySize = sizeof(TR_IPBCDataCallGraph);
 
-   if (!entry)
+   void *rawAddress = NULL;
+   void *alloc = TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(entrySize, &rawAddress);
+   if (!rawAddress)
       return NULL;
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
+   if (isCompact(byteCode))
+      entry = new (alloc) TR_IPBCDataFourBytes(pc);
+   else if (isSwitch(byteCode))
+      entry = new (alloc) TR_IPBCDataEightWords(pc);
+   else
+      entry = new (alloc) TR_IPBCDataCallGraph(pc);
+
+   // Both the IProfiler thread and application threads that parse their own
+   // buffers can add entries concurrently, so the new entry is published with
+   // a compare-and-swap. If we lose the race, only the entries that were added
+   // since the bucket was searched need to be searched again
+   TR_IPBytecodeHashTableEntry *oldHead = searchedHead;
+   while (true)
+      {
+      entry->setNext(oldHead);
+      FLUSH_MEMORY(TR::Compiler->target.isSMP());
+      TR_IPBytecodeHashTableEntry *crtHead = (TR_IPBytecodeHashTableEntry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&_bcHashTable[bucket], (uintptr_t)oldHead, (uintptr_t)entry);
+      if (crtHead == oldHead)
+         break;
+      for (TR_IPBytecodeHashTableEntry *other = crtHead; other != searchedHead; other = other->getNext())
+         {
+         if (other->getPC() == pc)
+            {
+            // Another thread added the same pc; our entry was never published
+            jitPersistentFree(rawAddress);
+#if defined(TR_HOST_64BIT)
+            memoryConsumed -= (int32_t)(entrySize + 4);
+#else
+            memoryConsumed -= (int32_t)entrySize;
+#endif
+            return other;
+            }
+         }
+      oldHead = searchedHead = crtHead;
+      }
 
    return entry;
    }
 
+static int
+compareIPSamplesByBucket(const void *a, const void *b)
+   {
+   const TR_IPSample *s1 = (const TR_IPSample *)a;
+   const TR_IPSample *s2 = (const TR_IPSample *)b;
+   if (s1->_bucket != s2->_bucket)
+      return s1->_bucket < s2->_bucket ? -1 : 1;
+   if (s1->_pc != s2->_pc)
+      return s1->_pc < s2->_pc ? -1 : 1;
+   return 0;
+   }
+
+//----------------------------- profilingSamples ---------------------------
+// Add to the bytecode hash table all the samples collected from a profiling
+// buffer. Samples are sorted by bucket so that all the samples for the same
+// pc are added with a single hash table lookup and consecutive lookups touch
+// neighbouring buckets
+//--------------------------------------------------------------------------
+void
+TR_IProfiler::profilingSamples(TR_IPSample *samples, int32_t numSamples)
+   {
+   for (int32_t i = 0; i < numSamples; i++)
+      samples[i]._bucket = bcHash(samples[i]._pc);
+   qsort(samples, numSamples, sizeof(*samples), compareIPSamplesByBucket);
+
+   for (int32_t i = 0; i < numSamples; )
+      {
+      uintptrj_t pc = samples[i]._pc;
+      TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(samples[i]._bucket, pc, true);
+      if (entry && invalidateEntryIfInconsistent(entry))
+         entry = NULL;
+      for (; i < numSamples && samples[i]._pc == pc; i++)
+         {
+         if (entry)
+            addSampleData(entry, samples[i]._data);
+         }
+      }
+   }
+
 TR_IPBCDataAllocation *
 TR_IProfiler::findOrCreateAllocEntry(int32_t bucket, uintptrj_t pc, bool addIt)
    {
@@ -2627,17 +2701,22 @@ TR_IProfiler::outputStats()
    }
 
 void *
-TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(size_t size)
+TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(size_t size, void **rawAddress)
    {
 #if defined(TR_HOST_64BIT)
    size += 4;
    memoryConsumed += (int32_t)size;
    void *address = (void *) jitPersistentAlloc(size);
+   if (rawAddress)
+      *rawAddress = address;
 
    return (void *)(((uintptrj_t)address + 4) & ~0x7);
 #else
    memoryConsumed += (int32_t)size;
-   return jitPersistentAlloc(size);
+   void *address = jitPersistentAlloc(size);
+   if (rawAddress)
+      *rawAddress = address;
+   return address;
 #endif
    }
 
@@ -3859,6 +3938,7 @@ extern "C" void stopInterpreterProfiling(J9JITConfig *jitConfig);
 
 /* Lower value will more aggressivly skip samples as the number of unloaded classes increasses */
 static const int IP_THROTTLE = 32;
+static const int IP_SAMPLE_BATCH_SIZE = 256; // number of samples added to the hash table at once by parseBuffer
 
 #if defined(NETWORK_ORDER_BYTECODE)
 static inline uint16_t readU16(U_8 *_offset) { return ((U_16)(*_offset)) << 8 | (*(_offset + 1)); }
@@ -3942,6 +4022,9 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
 
    J9JavaVM * javaVM = _compInfo->getJITConfig()->javaVM;
 
+   TR_IPSample batch[IP_SAMPLE_BATCH_SIZE];
+   int32_t batchSize = 0;
+
    int32_t skipCountMaster = 20+(rand()%10); // TODO: Use the master TR_RandomGenerator from jitconfig?
    int32_t skipCount = skipCountMaster;
    bool profileFlag = true;
@@ -4129,11 +4212,20 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
 
       if (addSample && !verboseReparse)
          {
-         profilingSample ((uintptrj_t)pc, (uintptrj_t)data, true);
+         batch[batchSize]._pc = (uintptrj_t)pc;
+         batch[batchSize]._data = (uintptrj_t)data;
+         if (++batchSize == IP_SAMPLE_BATCH_SIZE)
+            {
+            profilingSamples(batch, batchSize);
+            batchSize = 0;
+            }
          records++;
          }
       }
 
+   if (batchSize > 0)
+      profilingSamples(batch, batchSize);
+
    if (cursor != dataStart + size)
       {
       //j9tty_printf(PORTLIB, "Error! Parser overran buffer.\n");
@@ -4454,6 +4546,180 @@ class TR_AggregationHT
       TR_AggregationHTNode** _backbone;
    };
 
+static int
+compareUintptr(const void *a, const void *b)
+   {
+   uintptrj_t v1 = *(const uintptrj_t *)a;
+   uintptrj_t v2 = *(const uintptrj_t *)b;
+   return v1 < v2 ? -1 : (v1 > v2 ? 1 : 0);
+   }
+
+static J9ROMMethod *
+findROMMethodContainingPC(J9ROMClass *romClass, uintptrj_t pc)
+   {
+   J9ROMMethod *currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
+   for (U_32 i = 0; i < romClass->romMethodCount; i++)
+      {
+      if (pc >= (uintptrj_t)currentMethod && pc < (uintptrj_t)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod))
+         return currentMethod;
+      currentMethod = nextROMMethod(currentMethod);
+      }
+   return NULL;
+   }
+
+//--------------------------- persistAllEntries ---------------------------
+// Store in the shared class cache the IProfiler information of all methods
+// from the shared cache that do not have such information stored yet,
+// typically because they were never compiled. The data uses the same format
+// as the data stored by persistIprofileInfo at compile time, so the next run
+// finds it lazily through persistentProfilingSample.
+// Data is keyed by ROMMethod; a class that changed between runs gets a new
+// ROMClass in the cache and never sees the stale data.
+// Must be called after the IProfiler thread has been stopped
+//-------------------------------------------------------------------------
+void
+TR_IProfiler::persistAllEntries(J9VMThread *vmThread)
+   {
+   if (!TR::Options::sharedClassCache() ||
+       !TR::Options::_iprofilerPersistAtShutdown ||
+       TR::Options::getCmdLineOptions()->getOption(TR_DisablePersistIProfile) ||
+       TR::Options::getAOTCmdLineOptions()->getOption(TR_DisablePersistIProfile))
+      return;
+
+   J9JavaVM *javaVM = vmThread->javaVM;
+   J9InternalVMFunctions *vmFunctions = javaVM->internalVMFunctions;
+   J9SharedClassConfig *scConfig = javaVM->sharedClassConfig;
+   J9SharedClassCacheDescriptor *desc = scConfig->cacheDescriptorList;
+   uintptrj_t cacheOffset = (uintptrj_t)desc->cacheStartAddress;
+   uintptrj_t cacheSize = (uintptrj_t)desc->cacheSizeBytes;
+   TR::PersistentInfo *persistentInfo = _compInfo->getPersistentInfo();
+
+   uint32_t maxEntries = countEntries();
+   if (maxEntries == 0)
+      return;
+   uintptrj_t *pcEntries = (uintptrj_t *)jitPersistentAlloc(maxEntries * sizeof(uintptrj_t));
+   if (!pcEntries)
+      return;
+
+   // Need VM access to block GC from unloading classes while we walk the hashtable
+   bool haveAcquiredVMAccess = false;
+   if (!(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS))
+      {
+      acquireVMAccessNoSuspend(vmThread);
+      haveAcquiredVMAccess = true;
+      }
+
+   // Application threads may still add entries, so never go beyond maxEntries
+   uint32_t numPCs = 0;
+   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE && numPCs < maxEntries; bucket++)
+      {
+      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry && numPCs < maxEntries; entry = entry->getNext())
+         {
+         uintptrj_t pc = entry->getPC();
+         if (pc >= cacheOffset && pc < cacheOffset + cacheSize &&
+             !entry->isInvalid() && !invalidateEntryIfInconsistent(entry))
+            pcEntries[numPCs++] = pc;
+         }
+      }
+
+   // Bytecodes of a method are contiguous, so after sorting all
+   // the entries of a method are next to each other
+   qsort(pcEntries, numPCs, sizeof(*pcEntries), compareUintptr);
+
+   uint32_t numMethodsPersisted = 0;
+   uint32_t numEntriesPersisted = 0;
+   bool cacheFull = false;
+   for (uint32_t start = 0, end = 0; start < numPCs && !cacheFull; start = end)
+      {
+      J9ClassLoader *loader = NULL;
+      J9ROMClass *romClass = vmFunctions->findROMClassFromPC(vmThread, pcEntries[start], &loader);
+      J9ROMMethod *romMethod = romClass ? findROMMethodContainingPC(romClass, pcEntries[start]) : NULL;
+      if (!romMethod)
+         {
+         end = start + 1;
+         continue;
+         }
+      uintptrj_t methodEnd = (uintptrj_t)J9_BYTECODE_END_FROM_ROM_METHOD(romMethod);
+      for (end = start + 1; end < numPCs && pcEntries[end] < methodEnd; end++)
+         {}
+
+      if (!_compInfo->reloRuntime()->isROMClassInSharedCaches((uintptrj_t)romMethod, javaVM))
+         continue;
+
+      // Information stored at compile time takes precedence
+      unsigned char storeBuffer[1000];
+      J9SharedDataDescriptor descriptor;
+      descriptor.address = storeBuffer;
+      descriptor.length = sizeof(storeBuffer);
+      descriptor.type = J9SHR_ATTACHED_DATA_TYPE_JITPROFILE;
+      descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+      IDATA dataIsCorrupt;
+      if (scConfig->findAttachedData(vmThread, romMethod, &descriptor, &dataIsCorrupt))
+         {
+         _STATS_methodNotPersisted_alreadyStored++;
+         continue;
+         }
+
+      // Keep only the entries that can be persisted; this locks call graph entries
+      uint32_t numEntries = 0;
+      uint32_t bytesFootprint = 0;
+      for (uint32_t i = start; i < end; i++)
+         {
+         TR_IPBytecodeHashTableEntry *entry = profilingSample(pcEntries[i], 0, false);
+         if (entry && entry->canBePersisted(cacheOffset, cacheSize, persistentInfo) == IPBC_ENTRY_CAN_PERSIST)
+            {
+            bytesFootprint += entry->getBytesFootprint();
+            pcEntries[start + numEntries++] = pcEntries[i];
+            }
+         }
+
+      // The offset to a right child is stored on 16 bits
+      if (numEntries > 0 && bytesFootprint < (1 << 16))
+         {
+         void *memChunk = jitPersistentAlloc(bytesFootprint);
+         if (memChunk)
+            {
+            createBalancedBST(pcEntries + start, 0, numEntries - 1, (uintptrj_t)memChunk, NULL, cacheOffset);
+            descriptor.address = (U_8 *)memChunk;
+            descriptor.length = bytesFootprint;
+            UDATA store = scConfig->storeAttachedData(vmThread, romMethod, &descriptor, 0);
+            if (store == 0)
+               {
+               numMethodsPersisted++;
+               numEntriesPersisted += numEntries;
+               }
+            else if (store == J9SHR_RESOURCE_STORE_FULL)
+               {
+               cacheFull = true;
+               }
+            else
+               {
+               _STATS_persistError++;
+               }
+            jitPersistentFree(memChunk);
+            }
+         }
+
+      // release any entry that has been locked by us
+      for (uint32_t i = start; i < start + numEntries; i++)
+         {
+         TR_IPBCDataCallGraph *cgEntry = profilingSample(pcEntries[i], 0, false)->asIPBCDataCallGraph();
+         if (cgEntry)
+            cgEntry->releaseEntry();
+         }
+      }
+
+   if (haveAcquiredVMAccess)
+      releaseVMAccessNoSuspend(vmThread);
+   jitPersistentFree(pcEntries);
+
+   _STATS_methodPersisted += numMethodsPersisted;
+   _STATS_entriesPersisted += numEntriesPersisted;
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "IProfiler persisted %u entries for %u methods at shutdown%s",
+         numEntriesPersisted, numMethodsPersisted, cacheFull ? "; shared cache is full" : "");
+   }
+
 // Callback for qsort to sort by methodName
 int compareByMethodName(const void *a, const void *b)
    {
@@ -94,6 +94,15 @@ extern "C" __declspec(dllimport) void __stdcall DebugBreak();
 #endif
 #endif
 
+// A sample extracted from an interpreter profiling buffer that has not been
+// added to the bytecode hash table yet
+struct TR_IPSample
+   {
+   uintptrj_t _pc;
+   uintptrj_t _data;
+   int32_t    _bucket;
+   };
+
 struct TR_IPHashedCallSite  // TODO: is this needed?
    {
    //why do we even need this anymore?
@@ -188,7 +197,7 @@ class TR_IPBytecodeHashTableEntry
    {
 public:
    TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
-   static void* alignedPersistentAlloc(size_t size);
+   static void* alignedPersistentAlloc(size_t size, void **rawAddress = NULL);
    TR_IPBytecodeHashTableEntry(uintptrj_t pc) : _next(NULL), _pc(pc), _lastSeenClassUnloadID(-1), _entryFlags(0), _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG) {}
     
    uintptrj_t getPC() const { return _pc; }
@@ -502,6 +511,7 @@ public:
    leave the TR_ResolvedMethodSymbol argument for debugging purpose when called from Ilgen
    */
    void persistIprofileInfo(TR::ResolvedMethodSymbol *methodSymbol, TR_ResolvedMethod *method, TR::Compilation *comp);
+   void persistAllEntries(J9VMThread *vmThread); // called at shutdown
 
    void checkMethodHashTable();
 
@@ -597,7 +607,7 @@ private:
    bool acquireHashTableWriteLock(bool forceFullLock);
    void releaseHashTableWriteLock();
 
-   TR_IPBytecodeHashTableEntry *searchForSample(uintptrj_t pc, int32_t bucket);
+   TR_IPBytecodeHashTableEntry *searchForSample(uintptrj_t pc, TR_IPBytecodeHashTableEntry *head);
    TR_IPBCDataStorageHeader *searchForPersistentSample(TR_IPBCDataStorageHeader  *root, uintptrj_t pc);
    TR_IPBCDataAllocation *searchForAllocSample(uintptrj_t pc, int32_t bucket);
 
@@ -607,6 +617,8 @@ private:
    TR_IPBytecodeHashTableEntry *profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex,
                                                  TR::Compilation *comp, uintptrj_t data = 0xDEADF00D, bool addIt = false);
    TR_IPBytecodeHashTableEntry *profilingSample1 (uintptrj_t pc, uintptrj_t data, bool addIt = false);
+   // This method is used to add a batch of samples extracted from a profiling buffer
+   void profilingSamples (TR_IPSample *samples, int32_t numSamples);
    TR_IPBytecodeHashTableEntry * persistentProfilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *comp, bool *methodProfileExistsInSCC);
    TR_IPBCDataStorageHeader * persistentProfilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *comp, bool *methodProfileExistsInSCC, uintptrj_t *cacheOffset, TR_IPBCDataStorageHeader *store);
 
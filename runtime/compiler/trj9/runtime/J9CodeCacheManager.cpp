@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <string.h>
+#if defined(LINUX)
+#include <sys/mman.h>
+#endif
 #include "j9.h"
 #include "j9protos.h"
 #include "j9thread.h"
@@ -220,10 +223,41 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
                                       int32_t compThreadID,
                                       int32_t *numReserved)
    {
+   OMR::CodeCacheManager::CacheListCriticalSection scanCacheList(self());
+
+   // Keep warm and cold compilations out of the cache designated for hot code: hide it
+   // from the first-fit search by reserving it for the duration of the search. The hot
+   // cache is only handed out here when no other cache can be reserved.
+   TR::CodeCache *hiddenHotCodeCache = NULL;
+   if (_hotCodeCache && !_hotCodeCache->isReserved() && _hotCodeCache->almostFull() != TR_yes)
+      {
+      hiddenHotCodeCache = _hotCodeCache;
+      hiddenHotCodeCache->reserve(compThreadID);
+      }
+
    TR::CodeCache *codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
                                                                             sizeEstimate,
                                                                             compThreadID,
                                                                             numReserved);
+   if (hiddenHotCodeCache)
+      {
+      hiddenHotCodeCache->unreserve();
+      if (codeCache == NULL)
+         {
+         if (hiddenHotCodeCache->getFreeContiguousSpace() >= sizeEstimate)
+            {
+            // The hot cache is the only option left
+            hiddenHotCodeCache->reserve(compThreadID);
+            codeCache = hiddenHotCodeCache;
+            }
+         else if (numReserved && *numReserved > 0)
+            {
+            // The hot cache was only reserved by us, it must not make the failure look temporary
+            *numReserved -= 1;
+            }
+         }
+      }
+
    if (codeCache == NULL)
       {
       J9JITConfig *jitConfig = self()->fej9()->getJ9JITConfig();
@@ -232,6 +266,44 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
    return codeCache;
    }
 
+TR::CodeCache*
+J9::CodeCacheManager::reserveHotCodeCache(int32_t compThreadID)
+   {
+   OMR::CodeCacheManager::CacheListCriticalSection scanCacheList(self());
+
+   TR::CodeCache *codeCache = _hotCodeCache;
+   if (codeCache && codeCache->almostFull() != TR_yes)
+      {
+      if (codeCache->isReserved())
+         return NULL;
+      codeCache->reserve(compThreadID);
+      return codeCache;
+      }
+
+   // Designate a new hot code cache: the one with the most contiguous free space,
+   // which is usually the most recently allocated and least fragmented one
+   TR::CodeCache *candidate = NULL;
+   for (codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
+      {
+      if (!codeCache->isReserved() &&
+          codeCache->almostFull() != TR_yes &&
+          (!candidate || codeCache->getFreeContiguousSpace() > candidate->getFreeContiguousSpace()))
+         candidate = codeCache;
+      }
+
+   if (candidate)
+      {
+      _hotCodeCache = candidate;
+      candidate->reserve(compThreadID);
+      if (self()->codeCacheConfig().verboseCodeCache())
+         {
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "CodeCache %p designated for hot code, %u bytes free",
+            candidate, (uint32_t)candidate->getFreeContiguousSpace());
+         }
+      }
+   return candidate;
+   }
+
 void
 J9::CodeCacheManager::reportCodeLoadEvents()
    {
@@ -258,6 +330,7 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
    TR::CodeCacheConfig &config = self()->codeCacheConfig();
 
    size_t largeCodePageSize = config.largeCodePageSize();
+   bool useTransparentHugePages = false;
 #if defined(TR_TARGET_POWER) && defined(TR_HOST_POWER)
    /* Use largeCodePageSize on PPC only if its 16M.
     If we pass in any pagesize other than the default page size, the port library picks the shared memory api to allocate which wastes memory */
@@ -271,6 +344,16 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
       vmemParams.pageFlags = config.largeCodePageFlags();
       }
 
+#if defined(LINUX)
+   // Explicit large pages (-Xlp:codecache) take precedence; otherwise ask for a region
+   // that transparent huge pages can back completely
+   if (TR::Options::_jitCacheTransparentHugePages && vmemParams.pageSize < TRANSPARENT_HUGE_PAGE_SIZE)
+      {
+      useTransparentHugePages = true;
+      vmemParams.alignmentInBytes = TRANSPARENT_HUGE_PAGE_SIZE;
+      }
+#endif
+
    UDATA mode = J9PORT_VMEM_MEMORY_MODE_READ |
                 J9PORT_VMEM_MEMORY_MODE_WRITE |
                 J9PORT_VMEM_MEMORY_MODE_EXECUTE;
@@ -298,6 +381,8 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
    codeCacheSizeToAllocate = std::max(segmentSize, (config.codeCachePadKB() << 10));
    // For virtual allocations the size must always be a multiple of the page size
    codeCacheSizeToAllocate = (codeCacheSizeToAllocate + (vmemParams.pageSize-1)) & (~(vmemParams.pageSize-1));
+   if (useTransparentHugePages)
+      codeCacheSizeToAllocate = (codeCacheSizeToAllocate + (TRANSPARENT_HUGE_PAGE_SIZE-1)) & (~(TRANSPARENT_HUGE_PAGE_SIZE-1));
    vmemParams.byteAmount = codeCacheSizeToAllocate;
 
    void *defaultEndAddress = vmemParams.endAddress;
@@ -467,12 +552,33 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
    if (config.verboseCodeCache())
       TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "allocated code cache segment of size %u", codeCacheSizeToAllocate);
 
+   if (useTransparentHugePages)
+      {
+      size_t advisedSize = adviseTransparentHugePages(codeCacheSegment->heapBase, codeCacheSegment->heapTop);
+      if (config.verboseCodeCache())
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "code cache segment %p-%p: %u bytes advised for transparent huge pages%s",
+            codeCacheSegment->heapBase, codeCacheSegment->heapTop, (uint32_t)advisedSize, advisedSize ? "" : " (falling back to base pages)");
+      }
+
    TR::CodeCacheMemorySegment *memSegment = (TR::CodeCacheMemorySegment *) self()->getMemory(sizeof(TR::CodeCacheMemorySegment));
    new (memSegment) TR::CodeCacheMemorySegment(codeCacheSegment);
 
    return memSegment;
    }
 
+size_t
+J9::CodeCacheManager::adviseTransparentHugePages(void *start, void *end)
+   {
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+   uintptr_t alignedStart = ((uintptr_t)start + (TRANSPARENT_HUGE_PAGE_SIZE-1)) & ~(uintptr_t)(TRANSPARENT_HUGE_PAGE_SIZE-1);
+   uintptr_t alignedEnd = (uintptr_t)end & ~(uintptr_t)(TRANSPARENT_HUGE_PAGE_SIZE-1);
+   if (alignedEnd > alignedStart &&
+       0 == madvise((void *)alignedStart, alignedEnd - alignedStart, MADV_HUGEPAGE))
+      return alignedEnd - alignedStart;
+#endif
+   return 0;
+   }
+
 TR::CodeCacheMemorySegment *
 J9::CodeCacheManager::setupMemorySegmentFromRepository(uint8_t *start,
                                                       uint8_t *end,
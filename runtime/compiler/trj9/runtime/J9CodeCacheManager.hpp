@@ -53,7 +53,8 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -89,6 +90,11 @@ public:
                                     int32_t compThreadID,
                                     int32_t *numReserved);
 
+   // Reserve the code cache designated for hot and scorching bodies, so that they are kept
+   // together instead of being interleaved with the warm code that fills caches linearly.
+   // Returns NULL if the designated cache is reserved by another compilation thread.
+   TR::CodeCache * reserveHotCodeCache(int32_t compThreadID);
+
    TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start,
                                                                 uint8_t *end,
                                                                 size_t & codeCacheSizeToAllocate);
@@ -96,6 +102,12 @@ public:
 
    void reportCodeLoadEvents();
 
+   // Advise the kernel to back the 2MB-aligned part of [start, end) with transparent huge
+   // pages. Returns the number of bytes advised, 0 if none (not Linux, range too small,
+   // or THP disabled in the kernel).
+   static size_t adviseTransparentHugePages(void *start, void *end);
+
+   static const size_t TRANSPARENT_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
    static const uint32_t SAFE_DISTANCE_REPOSITORY_JITLIBRARY = 24 * 1024 * 1024;  // 24MB to account for some safe JIT library size
    static const uintptr_t UPPER_BOUND_DISTANCE_NEAR_JITLIBRARY_TO_AVOID_TRAMPOLINE = 0x80000000 - 24 * 1024 * 1024; // 2GB - 24MB
 
@@ -109,6 +121,7 @@ public:
 
 private :
    TR_FrontEnd *_fe;
+   TR::CodeCache *_hotCodeCache;
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
@@ -382,6 +382,11 @@ void TR_ValueProfiler::modifyTrees()
    //if (getInitialCompilation() && !comp()->getSymRefTab()->getSymRef(TR::SymbolReferenceTable::excpSymbol))
    //   return;
 
+   // Receivers beyond the top one are only consumed by multi-target profiled inlining
+   //
+   int32_t const maxPolymorphicTargets = TR::Options::getMaxPolymorphicProfiledTargets();
+   size_t const numExpandedReceivers = maxPolymorphicTargets > 1 ? maxPolymorphicTargets - 1 : 0;
+
    vcount_t visitCount = comp()->incVisitCount();
    TR::Block *block = NULL;
    for (TR::TreeTop * tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
@@ -509,7 +514,7 @@ void TR_ValueProfiler::modifyTrees()
                            }
                         else
                            {
-                           addProfilingTrees(dupChild, fallThroughBlock->getEntry());
+                           addProfilingTrees(dupChild, fallThroughBlock->getEntry(), numExpandedReceivers);
                            }
                         }
                      else
@@ -531,7 +536,9 @@ void TR_ValueProfiler::modifyTrees()
                   addProfilingTrees(firstChild->getFirstChild(), tt, 20);
                   }
                else
-                  addProfilingTrees(firstChild->getFirstChild(), tt);
+                  {
+                  addProfilingTrees(firstChild->getFirstChild(), tt, numExpandedReceivers);
+                  }
                }
             }
 
@@ -1445,6 +1445,23 @@ createMethodMetaData(
       tableSize += memoryUsedByMetadataMapping;
       }
 
+   // The PC to stack map lookup table is built into the metadata so that the first
+   // stack walk of the method does not have to build it in native memory
+   //
+   uint32_t stackMapTableOffset = 0;
+   uint32_t stackMapTableSize = 0;
+   if (!(vm->_jitConfig->runtimeFlags & J9JIT_TOSS_CODE) && !vm->isAOT_DEPRECATED_DO_NOT_USE() &&
+       !comp->getOption(TR_DoNotUseFastStackwalk))
+      {
+      stackMapTableSize = jitStackMapTableSize(vm->_jitConfig->javaVM, trStackAtlas->getNumberOfMaps());
+      if (stackMapTableSize)
+         {
+         tableSize = (tableSize + sizeof(uintptrj_t) - 1) & ~(sizeof(uintptrj_t) - 1);
+         stackMapTableOffset = tableSize;
+         tableSize += stackMapTableSize;
+         }
+      }
+
    /* Legend of the info stored at "data". From top to bottom, the address increases
 
       Exception Info
@@ -1456,6 +1473,8 @@ createMethodMetaData(
       Stack alloc map (if exists)
       --------------
       internal pointer map
+      --------------
+      Stack map lookup table (if exists)
 
    */
 
@@ -1601,6 +1620,9 @@ createMethodMetaData(
    if (!(vm->_jitConfig->runtimeFlags & J9JIT_TOSS_CODE) && !vm->isAOT_DEPRECATED_DO_NOT_USE())
       {
       TR_TranslationArtifactManager *artifactManager = TR_TranslationArtifactManager::getGlobalArtifactManager();
+
+      jitPrepareStackMapTable(vm->_jitConfig->javaVM, data, stackMapTableSize ? (uint8_t *)data + stackMapTableOffset : NULL);
+
       TR_TranslationArtifactManager::CriticalSection updateMetaData;
 
       if ( !(artifactManager->insertArtifact( static_cast<J9JITExceptionTable *>(data) ) ) )
@@ -96,9 +96,10 @@ static JITINLINE U_8 * getNextStackMap(TR_MapIterator * i, U_32 * mapCount, UDAT
    return i->_currentMap;
    }
 
+/* Code and stack map offsets are both relative to the method, so 32 bits are enough */
 typedef struct TR_MapTableEntry {
-   UDATA _lowCodeOffset;
-   UDATA _stackMapOffset;
+   U_32  _lowCodeOffset;
+   U_32  _stackMapOffset;
    U_32  _mapCount;
 } TR_MapTableEntry;
 
@@ -123,11 +124,14 @@ typedef struct TR_PersistentJittedBodyInfo {
 
 static const U_32 TR_StackMapTable_magicNumber = 0xABCDEFAB;
 
-static JITINLINE TR_StackMapTable * initializeMapTable(J9JavaVM * javaVM, J9TR_MethodMetaData * metaData, UDATA fourByteOffsets)
-   {
-   /* How big should the table be before we give up on linear search? */
-   const U_32 threshold = 6;
+/* How big should the table be before we give up on linear search? */
+static const U_32 TR_StackMapTable_threshold = 6;
 
+/* Build the table in mapTableStorage when the compiler reserved room for it in the
+ * metadata, otherwise in native memory that freeFastWalkCache releases.
+ */
+static JITINLINE TR_StackMapTable * initializeMapTable(J9JavaVM * javaVM, J9TR_MethodMetaData * metaData, UDATA fourByteOffsets, void * mapTableStorage)
+   {
    J9JITStackAtlas * stackAtlas = 0;
    U_8 * addressOfFirstMap = 0;
    U_32 mapCount = 0;
@@ -139,14 +143,18 @@ static JITINLINE TR_StackMapTable * initializeMapTable(J9JavaVM * javaVM, J9TR_M
    stackAtlas = (J9JITStackAtlas *)metaData->gcStackAtlas;
    assert(stackAtlas);
 
-   initializeIterator(&i, metaData);
-   while(getNextStackMap(&i, &mapCount, fourByteOffsets))
-      { ++concreteMapCount; }
-
-   if (i._stackAtlas->numberOfMaps > threshold)
+   if (stackAtlas->numberOfMaps > TR_StackMapTable_threshold)
       {
       PORT_ACCESS_FROM_JAVAVM(javaVM);
-      mapTable = (TR_StackMapTable *) j9mem_allocate_memory(concreteMapCount * sizeof(TR_MapTableEntry) + sizeof(TR_StackMapTable), J9MEM_CATEGORY_JIT);
+
+      initializeIterator(&i, metaData);
+      while(getNextStackMap(&i, &mapCount, fourByteOffsets))
+         { ++concreteMapCount; }
+
+      if (mapTableStorage)
+         mapTable = (TR_StackMapTable *) mapTableStorage;
+      else
+         mapTable = (TR_StackMapTable *) j9mem_allocate_memory(concreteMapCount * sizeof(TR_MapTableEntry) + sizeof(TR_StackMapTable), J9MEM_CATEGORY_JIT);
 
       if (mapTable)
          {
@@ -166,7 +174,7 @@ static JITINLINE TR_StackMapTable * initializeMapTable(J9JavaVM * javaVM, J9TR_M
          for (index = 0; getNextStackMap(&i, &mapCount, fourByteOffsets); ++index)
             {
             mapTable->_table[index]._lowCodeOffset = i._rangeStartOffset;
-            mapTable->_table[index]._stackMapOffset = (UDATA) (i._currentMap - addressOfFirstMap);
+            mapTable->_table[index]._stackMapOffset = (U_32) (i._currentMap - addressOfFirstMap);
             mapTable->_table[index]._mapCount = mapCount - 1;
             }
          assert(index == concreteMapCount);
@@ -180,6 +188,13 @@ static JITINLINE TR_StackMapTable * initializeMapTable(J9JavaVM * javaVM, J9TR_M
          ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->_mapTable = mapTable;
          }
       }
+   else
+      {
+      /* Too few maps for a table to pay off; record that so that later walks go
+       * straight to the linear search instead of coming back here every time.
+       */
+      ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->_mapTable = NULL;
+      }
 
    return mapTable;
    }
@@ -194,7 +209,7 @@ static JITINLINE TR_StackMapTable * findOrCreateMapTable(J9JavaVM * javaVM, J9TR
       {
       mapTablePtr = ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->_mapTable; /* cache it */
       if (mapTablePtr == (TR_StackMapTable *)-1) /* if nobody wrote to it yet */
-        { mapTablePtr = initializeMapTable(javaVM, metaData, fourByteOffsets); }
+        { mapTablePtr = initializeMapTable(javaVM, metaData, fourByteOffsets, NULL); }
 #if defined(TR_HOST_64BIT)
       if (((U_32)((UDATA)mapTablePtr) == (U_32)-1) || ((U_32)((UDATA)mapTablePtr >> 32) == (U_32)-1)) /* check upper and lower word */
          { mapTablePtr = 0; } /* give up the optimization */
@@ -204,6 +219,54 @@ static JITINLINE TR_StackMapTable * findOrCreateMapTable(J9JavaVM * javaVM, J9TR
    return mapTablePtr;
    }
 
+/**
+ * Number of bytes the compiler should reserve at the end of a method's metadata for its stack
+ * map table, or 0 if the method gets no table. The reservation is sized for every map in the
+ * atlas; only maps that start a new range get an entry, so the table may use less.
+ */
+UDATA jitStackMapTableSize(J9JavaVM * javaVM, UDATA numberOfMaps)
+   {
+#ifdef FASTWALK
+   if (numberOfMaps > TR_StackMapTable_threshold &&
+       (javaVM->phase == J9VM_PHASE_NOT_STARTUP || 0 == (javaVM->jitConfig->runtimeFlags & J9JIT_QUICKSTART)))
+      return numberOfMaps * sizeof(TR_MapTableEntry) + sizeof(TR_StackMapTable);
+#endif /* def FASTWALK */
+   return 0;
+   }
+
+/**
+ * Build the stack map table of a newly compiled body in mapTableStorage, which the compiler
+ * reserved in the body's metadata using jitStackMapTableSize, before the body is published to
+ * stack walkers. Otherwise the table would be built by the first walk of one of the method's
+ * frames, which is usually a GC root scan with the world stopped. Bodies with too few maps
+ * record a NULL table so that their walks go straight to the linear search.
+ */
+void jitPrepareStackMapTable(J9JavaVM * javaVM, J9TR_MethodMetaData * methodMetaData, void * mapTableStorage)
+   {
+#ifdef FASTWALK
+   TR_PersistentJittedBodyInfo * bodyInfo = (TR_PersistentJittedBodyInfo *)methodMetaData->bodyInfo;
+   J9JITStackAtlas * stackAtlas = (J9JITStackAtlas *)methodMetaData->gcStackAtlas;
+
+   if (!(methodMetaData->flags & JIT_METADATA_IS_STUB) && stackAtlas && bodyInfo &&
+       bodyInfo->_mapTable == (void *)-1)
+      {
+      if (stackAtlas->numberOfMaps <= TR_StackMapTable_threshold)
+         bodyInfo->_mapTable = NULL;
+      else if (mapTableStorage)
+         initializeMapTable(javaVM, methodMetaData, HAS_FOUR_BYTE_OFFSET(methodMetaData), mapTableStorage);
+      }
+#endif /* def FASTWALK */
+   }
+
+/**
+ * Whether mapTable was built inside the metadata by jitPrepareStackMapTable, in which case it
+ * is released along with the metadata and must not be freed on its own.
+ */
+UDATA jitIsStackMapTableInMetaData(J9TR_MethodMetaData * methodMetaData, void * mapTable)
+   {
+   return (U_8 *)mapTable >= (U_8 *)methodMetaData && (U_8 *)mapTable < (U_8 *)methodMetaData + methodMetaData->size;
+   }
+
 static JITINLINE void * currentInlineMap(TR_MapIterator * i)
    {
    return i->_currentInlineMap;
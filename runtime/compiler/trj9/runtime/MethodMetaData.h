@@ -31,6 +31,9 @@
 #define jitGetStackMapFromPC jitGetStackMapFromPCVerbose
 #define jitGetInlinerMapFromPC jitGetInlinerMapFromPCVerbose
 #define jitGetMapsFromPC jitGetMapsFromPCVerbose
+#define jitStackMapTableSize jitStackMapTableSizeVerbose
+#define jitPrepareStackMapTable jitPrepareStackMapTableVerbose
+#define jitIsStackMapTableInMetaData jitIsStackMapTableInMetaDataVerbose
 #define jitGetExceptionTableFromPC jitGetExceptionTableFromPCVerbose
 #define jitCalleeSavedRegisterList jitCalleeSavedRegisterListVerbose
 #define walkFrame walkFrameVerbose
@@ -267,6 +270,9 @@ void * getStackAllocMapFromJitPC(J9JavaVM * javaVM, J9TR_MethodMetaData * except
 UDATA jitExceptionHandlerSearch(J9VMThread * currentThread, J9StackWalkState * walkState);
 void * jitGetInlinerMapFromPC(J9JavaVM * javaVM, J9JITExceptionTable * exceptionTable, UDATA jitPC);
 void jitGetMapsFromPC(J9JavaVM * javaVM, J9JITExceptionTable * exceptionTable, UDATA jitPC, void * * inlineMap, void * * stackMap);
+UDATA jitStackMapTableSize(J9JavaVM * javaVM, UDATA numberOfMaps);
+void jitPrepareStackMapTable(J9JavaVM * javaVM, J9JITExceptionTable * exceptionTable, void * mapTableStorage);
+UDATA jitIsStackMapTableInMetaData(J9JITExceptionTable * exceptionTable, void * mapTable);
 void * getFirstInlineRange(TR_MapIterator * i, void * methodMetaData, UDATA * startOffset, UDATA * endOffset);
 void * getNextInlineRange(TR_MapIterator * i, UDATA * startOffset, UDATA * endOffset);
 void walkJITFrameSlotsForInternalPointers(J9StackWalkState * walkState,  U_8 ** jitDescriptionCursor, UDATA * scanCursor, void *stackMap, J9JITStackAtlas *gcStackAtlas);
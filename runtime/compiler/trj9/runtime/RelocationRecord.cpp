@@ -251,15 +251,35 @@ TR_RelocationRecordGroup::applyRelocations(TR_RelocationRuntime *reloRuntime,
                                            TR_RelocationTarget *reloTarget,
                                            uint8_t *reloOrigin)
    {
-   TR_RelocationRecordBinaryTemplate *recordPointer = firstRecord(reloTarget);
+   TR_RelocationRecordBinaryTemplate *recordPointer = NULL;
    TR_RelocationRecordBinaryTemplate *endOfRecords = pastLastRecord(reloTarget);
 
-   while (recordPointer < endOfRecords)
+   // Validation records do not patch anything, so apply them all first: a body that
+   // fails validation is then rejected before any code is patched, trampolines are
+   // reserved or runtime assumptions are created on its behalf
+   //
+   for (recordPointer = firstRecord(reloTarget); recordPointer < endOfRecords; )
+      {
+      TR_RelocationRecord reloRecord(reloTarget, recordPointer, reloRuntime);
+      if (isValidationRecord(reloRecord.type(reloTarget)))
+         {
+         int32_t rc = handleRelocation(reloRuntime, reloTarget, &reloRecord, reloOrigin);
+         if (rc != 0)
+            return rc;
+         }
+
+      recordPointer = reloRecord.nextBinaryRecord(reloTarget);
+      }
+
+   for (recordPointer = firstRecord(reloTarget); recordPointer < endOfRecords; )
       {
       TR_RelocationRecord reloRecord(reloTarget, recordPointer, reloRuntime);
-      int32_t rc = handleRelocation(reloRuntime, reloTarget, &reloRecord, reloOrigin);
-      if (rc != 0)
-         return rc;
+      if (!isValidationRecord(reloRecord.type(reloTarget)))
+         {
+         int32_t rc = handleRelocation(reloRuntime, reloTarget, &reloRecord, reloOrigin);
+         if (rc != 0)
+            return rc;
+         }
 
       recordPointer = reloRecord.nextBinaryRecord(reloTarget);
       }
@@ -267,6 +287,21 @@ TR_RelocationRecordGroup::applyRelocations(TR_RelocationRuntime *reloRuntime,
    return 0;
    }
 
+bool
+TR_RelocationRecordGroup::isValidationRecord(uint8_t reloType)
+   {
+   switch (reloType)
+      {
+      case TR_ValidateClass:
+      case TR_ValidateInstanceField:
+      case TR_ValidateStaticField:
+      case TR_ValidateArbitraryClass:
+         return true;
+      default:
+         return false;
+      }
+   }
+
 
 int32_t
 TR_RelocationRecordGroup::handleRelocation(TR_RelocationRuntime *reloRuntime,
@@ -57,6 +57,7 @@ class TR_RelocationRecordGroup
                                uint8_t *reloOrigin);
    private:
       int32_t handleRelocation(TR_RelocationRuntime *reloRuntime, TR_RelocationTarget *reloTarget, TR_RelocationRecord *reloRecord, uint8_t *reloOrigin);
+      static bool isValidationRecord(uint8_t reloType);
 
       TR_RelocationRecordBinaryTemplate *_group;
    };
@@ -41,10 +41,17 @@
 #include "runtime/RelocationRecord.hpp"
 #include "runtime/RelocationRuntime.hpp"
 #include "runtime/RelocationTarget.hpp"
+#include "env/IO.hpp"
+#include "AtomicSupport.hpp"
 
 // RelocationRuntimeLogger class
 static const char *headerTag = "relocatableDataRT";
 
+volatile uintptr_t TR_RelocationRuntimeLogger::_totalRelocatedBodies = 0;
+volatile uintptr_t TR_RelocationRuntimeLogger::_totalRelocationTime = 0;
+volatile uintptr_t TR_RelocationRuntimeLogger::_startupRelocatedBodies = 0;
+volatile uintptr_t TR_RelocationRuntimeLogger::_startupRelocationTime = 0;
+
 TR_RelocationRuntimeLogger::TR_RelocationRuntimeLogger(TR_RelocationRuntime *reloRuntime)
    {
    _reloRuntime = reloRuntime;
@@ -234,12 +241,20 @@ TR_RelocationRuntimeLogger::relocationDump()
 void
 TR_RelocationRuntimeLogger::relocationTime()
    {
-   if (verbose())
+   J9JavaVM *javaVM = jitConfig()->javaVM;
+   PORT_ACCESS_FROM_JAVAVM(javaVM);
+   UDATA reloEndTime = j9time_usec_clock();
+
+   VM_AtomicSupport::add(&_totalRelocatedBodies, 1);
+   VM_AtomicSupport::add(&_totalRelocationTime, reloEndTime - _reloStartTime);
+   if (javaVM->phase != J9VM_PHASE_NOT_STARTUP)
       {
-      J9JavaVM *javaVM = jitConfig()->javaVM;
-      PORT_ACCESS_FROM_JAVAVM(javaVM);
-      UDATA reloEndTime = j9time_usec_clock();
+      VM_AtomicSupport::add(&_startupRelocatedBodies, 1);
+      VM_AtomicSupport::add(&_startupRelocationTime, reloEndTime - _reloStartTime);
+      }
 
+   if (verbose())
+      {
       bool wasLocked = lockLog();
       method(false);
       JITRT_PRINTF(jitConfig())(jitConfig(), " <%p-%p> ",
@@ -250,6 +265,20 @@ TR_RelocationRuntimeLogger::relocationTime()
       }
    }
 
+void
+TR_RelocationRuntimeLogger::printRelocationTotals()
+   {
+   if (_totalRelocatedBodies == 0)
+      return;
+
+   TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "AOT relocations: %u bodies in %u usec (%u usec/body); during startup %u bodies in %u usec",
+      (uint32_t)_totalRelocatedBodies,
+      (uint32_t)_totalRelocationTime,
+      (uint32_t)(_totalRelocationTime / _totalRelocatedBodies),
+      (uint32_t)_startupRelocatedBodies,
+      (uint32_t)_startupRelocationTime);
+   }
+
 void
 TR_RelocationRuntimeLogger::versionMismatchWarning()
    {
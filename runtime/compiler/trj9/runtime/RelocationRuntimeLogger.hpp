@@ -62,6 +62,9 @@ class TR_RelocationRuntimeLogger {
 
       void relocationDump();
       void relocationTime();
+
+      // Totals over all relocation runtimes, reported at shutdown
+      static void printRelocationTotals();
       void versionMismatchWarning();
       void maxCodeOrDataSizeWarning();
 
@@ -84,6 +87,11 @@ class TR_RelocationRuntimeLogger {
       bool _verbose;
  
       UDATA _reloStartTime;
+
+      static volatile uintptr_t _totalRelocatedBodies;
+      static volatile uintptr_t _totalRelocationTime;          // usec
+      static volatile uintptr_t _startupRelocatedBodies;
+      static volatile uintptr_t _startupRelocationTime;        // usec
    };
 
 #endif   // RELOCATION_RUNTIME_LOGGER_INCL
@@ -130,9 +130,9 @@ class TR_PersistentClassInfo : public TR_Link0<TR_PersistentClassInfo>
    void setShouldNotBeNewlyExtended(int32_t ID) { _shouldNotBeNewlyExtended.set(1 << ID); }
    void resetShouldNotBeNewlyExtended(int32_t ID){ _shouldNotBeNewlyExtended.reset(1 << ID); }
    void clearShouldNotBeNewlyExtended()          { _shouldNotBeNewlyExtended.clear(); }
-   bool shouldNotBeNewlyExtended()               { return _shouldNotBeNewlyExtended.testAny(0xff); }
+   bool shouldNotBeNewlyExtended()               { return _shouldNotBeNewlyExtended.testAny(0xffff); }
    bool shouldNotBeNewlyExtended(int32_t ID)     { return _shouldNotBeNewlyExtended.testAny(1 << ID); }
-   flags8_t getShouldNotBeNewlyExtendedMask() const { return _shouldNotBeNewlyExtended; }
+   flags16_t getShouldNotBeNewlyExtendedMask() const { return _shouldNotBeNewlyExtended; }
 
    void setHasRecognizedAnnotations(bool v = true){ _flags.set(_containsRecognizedAnnotations, v); }
    bool hasRecognizedAnnotations()                { return _flags.testAny(_containsRecognizedAnnotations); }
@@ -179,7 +179,7 @@ class TR_PersistentClassInfo : public TR_Link0<TR_PersistentClassInfo>
    uint16_t                            _timeStamp;
    int32_t                             _nameLength;
    flags8_t                            _flags;
-   flags8_t                            _shouldNotBeNewlyExtended; // one bit for each possible compilation thread
+   flags16_t                           _shouldNotBeNewlyExtended; // one bit for each possible compilation thread
    };
 
 class TR_AddressRange
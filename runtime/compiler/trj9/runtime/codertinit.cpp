@@ -365,7 +365,8 @@ void codert_freeJITConfig(J9JavaVM * javaVM)
                      void *mapTablePtr = ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->getMapTable();
                      if (mapTablePtr != (void*)-1 && mapTablePtr != NULL)
                         {
-                        j9mem_free_memory(mapTablePtr);
+                        if (!jitIsStackMapTableInMetaData(metaData, mapTablePtr))
+                           j9mem_free_memory(mapTablePtr);
                         ((TR_PersistentJittedBodyInfo *)metaData->bodyInfo)->setMapTable(NULL);
                         }
                      }
@@ -1440,6 +1440,12 @@ TR::Register *TR::AMD64JNILinkage::buildDirectJNIDispatch(TR::Node *callNode)
                                                  callSymRef->getReferenceNumber() == TR_flushGPU ||
                                                  callSymRef->getReferenceNumber() == TR_regionExitGPU);
 
+   // CRC32 natives that J9::Node::processJNICall left unwrapped are redirected to crc32_updateBytes_pclmul
+   bool specialCaseJNI = !isGPUHelper && callNode->isPreparedForDirectJNI() &&
+                         (callSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateBytes ||
+                          callSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateByteBuffer) &&
+                         callNode->getNumChildren() == 4;
+
    static bool keepVMDuringGPUHelper = feGetEnv("TR_KeepVMDuringGPUHelper") ? true : false;
 
    TR::Register *vmThreadReg = cg()->getMethodMetaDataRegister();
@@ -1516,7 +1522,7 @@ TR::Register *TR::AMD64JNILinkage::buildDirectJNIDispatch(TR::Node *callNode)
    static char * disablePureFn = feGetEnv("TR_DISABLE_PURE_FUNC_RECOGNITION");
    if (!isGPUHelper)
       {
-      if (resolvedMethodSymbol->canDirectNativeCall())
+      if (resolvedMethodSymbol->canDirectNativeCall() || specialCaseJNI)
          {
          dropVMAccess = false;
          killNonVolatileGPRs = false;
@@ -1524,6 +1530,15 @@ TR::Register *TR::AMD64JNILinkage::buildDirectJNIDispatch(TR::Node *callNode)
          checkExceptions = false;
          createJNIFrame = false;
          tearDownJNIFrame = false;
+         if (specialCaseJNI)
+            {
+            // The call node has no class argument and the byte[] has already been
+            // replaced by the address of its first element
+            //
+            wrapRefs = false;
+            passReceiver = true;
+            passThread = false;
+            }
          }
       else if (callNode->getSymbol()->castToResolvedMethodSymbol()->isPureFunction() && (disablePureFn == NULL))
          {
@@ -1594,6 +1609,10 @@ TR::Register *TR::AMD64JNILinkage::buildDirectJNIDispatch(TR::Node *callNode)
       callNode->setSymbolReference(gpuHelperSymRef);
       targetAddress = (uintptrj_t)callSymbol->getMethodAddress();
       }
+   else if (specialCaseJNI)
+      {
+      targetAddress = (uintptrj_t)crc32_updateBytes_pclmul;
+      }
    else
       {
       TR::ResolvedMethodSymbol *callSymbol1  = callNode->getSymbol()->castToResolvedMethodSymbol();
@@ -30,6 +30,11 @@
 #include "codegen/AMD64PrivateLinkage.hpp"
 #include "env/jittypes.h"
 
+extern "C"
+   {
+   uint32_t crc32_updateBytes_pclmul(uint32_t crc, uint8_t *buf, int32_t off, int32_t len);
+   }
+
 namespace TR { class CodeGenerator; }
 namespace TR { class Instruction; }
 namespace TR { class LabelSymbol; }
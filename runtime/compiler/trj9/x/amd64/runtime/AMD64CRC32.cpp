@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#include "j9comp.h"
+#include "util_api.h"
+
+#if defined(__GNUC__)
+#define CRC32_PCLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+#define CRC32_ALIGN16 __attribute__((aligned(16)))
+#else
+#define CRC32_PCLMUL_TARGET
+#define CRC32_ALIGN16 __declspec(align(16))
+#endif
+
+// Fold constants for the reflected CRC-32 polynomial 0x04C11DB7 used by java.util.zip.CRC32.
+// See "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel).
+//
+static const uint64_t CRC32_ALIGN16 k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+static const uint64_t CRC32_ALIGN16 k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+static const uint64_t CRC32_ALIGN16 k5k0[] = { 0x0163cd6124, 0x0000000000 };
+static const uint64_t CRC32_ALIGN16 poly[] = { 0x01db710641, 0x01f7011641 };
+
+// Process len bytes, where len >= 64 and len is a multiple of 16.  crc is the
+// pre-conditioned (inverted) running value and the result is returned in the same form.
+//
+static CRC32_PCLMUL_TARGET uint32_t
+crc32_fold_pclmul(const uint8_t *buf, intptr_t len, uint32_t crc)
+   {
+   __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+   x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+   x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+   x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+   x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+   x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+   x0 = _mm_load_si128((const __m128i *)k1k2);
+   buf += 64;
+   len -= 64;
+
+   // Fold four 128-bit lanes in parallel
+   //
+   while (len >= 64)
+      {
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+      x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+      x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+      x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+      x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+      y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+      y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+      y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+      y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+      x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+      x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+      x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+      buf += 64;
+      len -= 64;
+      }
+
+   // Fold the four lanes into one
+   //
+   x0 = _mm_load_si128((const __m128i *)k3k4);
+   x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+   x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+   x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+   x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+   x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+   x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+   x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+   x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+   x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+   // Fold any remaining 16 byte blocks
+   //
+   while (len >= 16)
+      {
+      x2 = _mm_loadu_si128((const __m128i *)buf);
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+      buf += 16;
+      len -= 16;
+      }
+
+   // Fold 128 bits down to 64
+   //
+   x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+   x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+   x1 = _mm_srli_si128(x1, 8);
+   x1 = _mm_xor_si128(x1, x2);
+   x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+   x2 = _mm_srli_si128(x1, 4);
+   x1 = _mm_and_si128(x1, x3);
+   x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+   x1 = _mm_xor_si128(x1, x2);
+
+   // Barrett reduction to 32 bits
+   //
+   x0 = _mm_load_si128((const __m128i *)poly);
+   x2 = _mm_and_si128(x1, x3);
+   x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+   x2 = _mm_and_si128(x2, x3);
+   x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+   x1 = _mm_xor_si128(x1, x2);
+
+   return (uint32_t)_mm_extract_epi32(x1, 1);
+   }
+
+// Target of direct calls to java.util.zip.CRC32.updateBytes and updateByteBuffer.
+// buf is the first element of the byte[] (or the buffer address) and off/len are the
+// Java arguments, so the result matches the zlib crc32() call the JNI natives make.
+//
+extern "C" uint32_t
+crc32_updateBytes_pclmul(uint32_t crc, uint8_t *buf, int32_t off, int32_t len)
+   {
+   buf += off;
+
+   if (len >= 64)
+      {
+      intptr_t foldLength = len & ~15;
+      crc = ~crc32_fold_pclmul(buf, foldLength, ~crc);
+      buf += foldLength;
+      len -= (int32_t)foldLength;
+      }
+
+   if (len > 0)
+      crc = j9crc32(crc, buf, (U_32)len);
+
+   return crc;
+   }
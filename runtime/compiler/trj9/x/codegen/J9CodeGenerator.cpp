@@ -117,6 +117,16 @@ J9::X86::CodeGenerator::CodeGenerator() :
          }
       }
 
+   // Let the SPMD parallelizer vectorize counted loops.  Which vector opcodes it
+   // may generate is still decided per opcode by getSupportsOpCodeForAutoSIMD.
+   //
+   if (TR::CodeGenerator::getX86ProcessorInfo().supportsSSE4_1() &&
+       !comp->getOption(TR_DisableSIMD) &&
+       !comp->getOption(TR_DisableAutoSIMD))
+      {
+      cg->setSupportsAutoSIMD();
+      }
+
    // We do not support fast CTM in mimic interpreter stack mode because it causes problems when
    // a stack slot is shared between a reference and a long value. The specific case is that there is
    // a reference value in a stack slot first and then there is supposed to be the long value that is
@@ -12047,6 +12047,186 @@ inlineStringHashCode(
    return false;
    }
 
+// Search a compressed (byte) or decompressed (char) String value array for a character with SSE2,
+// comparing 16 bytes per iteration and finishing the remainder with a serial loop.
+//
+// start_label
+// if end - i < elementsPerVector, goto serial_label
+//    GPR1 = c * [0x01010101 | 0x00010001]
+//    movd xmm0, GPR1
+//    pshufd xmm0, xmm0, 0     broadcast c into every element of xmm0
+//    GPR2 = end - elementsPerVector
+// SSEloop
+//    xmm1 = load 16 bytes value[i]
+//    pcmpeqb xmm1, xmm0
+//    pmovmskb GPR1, xmm1
+//    if decompressed, GPR1 = GPR1 & (GPR1 >> 1) & 0x5555      both bytes of a char must match
+//    test GPR1, GPR1
+//    jne SSEFound_label
+//    i = i + elementsPerVector
+//    cmp i, GPR2
+//    jle SSEloop
+//
+// serial_label
+// cmp i, end
+// jge notFound_label
+// serial_loop
+// GPR1 = load value[i]
+// cmp GPR1, c
+// je found_label
+// inc i
+// cmp i, end
+// jl serial_loop
+//
+// notFound_label
+// result = -1
+// jmp end_label
+//
+// SSEFound_label
+// bsf GPR1, GPR1
+// if decompressed, GPR1 = GPR1 >> 1
+// i = i + GPR1
+//
+// found_label
+// result = i
+//
+// end_label
+static bool
+inlineStringIndexOf(
+      TR::Node *node,
+      bool isIndirect,
+      bool isCompressed,
+      TR::CodeGenerator *cg)
+   {
+   TR::Compilation *comp = cg->comp();
+
+   if (isIndirect)
+      {
+      diagnostic("String.indexOf called indirectly by %s\n", comp->signature());
+      return false;
+      }
+
+   const uint8_t elementSize = isCompressed ? 1 : 2;
+   const int32_t elementsPerVector = 16 / elementSize;
+
+   TR::LabelSymbol *startLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *endLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *SSELabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *SSEFoundLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *SerialLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *SerialLoopLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *notFoundLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *foundLabel = generateLabelSymbol(cg);
+   startLabel->setStartInternalControlFlow();
+   endLabel->setEndInternalControlFlow();
+
+   // get register for value, c, start, end
+   TR::Node *valueNode = node->getChild(0);
+   TR::Node *charNode = node->getChild(1);
+   TR::Node *startNode = node->getChild(2);
+   TR::Node *endNode = node->getChild(3);
+
+   TR::Register *valueReg = cg->evaluate(valueNode);
+   TR::Register *charReg = cg->evaluate(charNode);
+   // indexReg is advanced in place, so take a copy if the start value is still live
+   TR::Register *indexReg = intOrLongClobberEvaluate(startNode, getNodeIs64Bit(startNode, cg), cg);
+   TR::Register *endReg = cg->evaluate(endNode);
+   TR::Register *resultReg = cg->allocateRegister();
+   TR::Register *tempReg = cg->allocateRegister();
+   TR::Register *maskReg = cg->allocateRegister();
+   TR::Register *xmm0 = cg->allocateRegister(TR_FPR);
+   TR::Register *xmm1 = cg->allocateRegister(TR_FPR);
+
+   generateLabelInstruction(LABEL, node, startLabel, cg);
+   generateRegRegInstruction(MOV4RegReg, node, tempReg, endReg, cg);
+   generateRegRegInstruction(SUB4RegReg, node, tempReg, indexReg, cg);
+   generateRegImmInstruction(CMP4RegImm4, node, tempReg, elementsPerVector, cg);
+   generateLabelInstruction(JL4, node, SerialLabel, cg);
+
+   // SSE version
+   // xmm0 = c replicated into every byte or char
+   generateRegRegImmInstruction(IMUL4RegRegImm4, node, tempReg, charReg, isCompressed ? 0x01010101 : 0x00010001, cg);
+   generateRegRegInstruction(MOVDRegReg4, node, xmm0, tempReg, cg);
+   generateRegRegImmInstruction(PSHUFDRegRegImm1, node, xmm0, xmm0, 0x00, cg);
+   generateRegRegInstruction(MOV4RegReg, node, resultReg, endReg, cg);
+   generateRegImmInstruction(SUB4RegImms, node, resultReg, elementsPerVector, cg);
+
+   generateLabelInstruction(LABEL, node, SSELabel, cg);
+   generateRegMemInstruction(MOVDQURegMem,
+                             node,
+                             xmm1,
+                             generateX86MemoryReference(valueReg, indexReg, isCompressed ? 0 : 1, TR::Compiler->om.contiguousArrayHeaderSizeInBytes(), cg),
+                             cg);
+   generateRegRegInstruction(PCMPEQBRegReg, node, xmm1, xmm0, cg);
+   generateRegRegInstruction(PMOVMSKB4RegReg, node, tempReg, xmm1, cg);
+   if (!isCompressed)
+      {
+      // a char matches only when both of its bytes do; keep the mask bit of the low byte
+      generateRegRegInstruction(MOV4RegReg, node, maskReg, tempReg, cg);
+      generateRegImmInstruction(SHR4RegImm1, node, maskReg, 1, cg);
+      generateRegRegInstruction(AND4RegReg, node, tempReg, maskReg, cg);
+      generateRegImmInstruction(AND4RegImm4, node, tempReg, 0x5555, cg);
+      }
+   generateRegRegInstruction(TEST4RegReg, node, tempReg, tempReg, cg);
+   generateLabelInstruction(JNE4, node, SSEFoundLabel, cg);
+   generateRegImmInstruction(ADDRegImms(), node, indexReg, elementsPerVector, cg);
+   generateRegRegInstruction(CMP4RegReg, node, indexReg, resultReg, cg);
+   generateLabelInstruction(JLE4, node, SSELabel, cg);
+
+   // Serial label
+   generateLabelInstruction(LABEL, node, SerialLabel, cg);
+   generateRegRegInstruction(CMP4RegReg, node, indexReg, endReg, cg);
+   generateLabelInstruction(JGE4, node, notFoundLabel, cg);
+   generateLabelInstruction(LABEL, node, SerialLoopLabel, cg);
+   generateRegMemInstruction(isCompressed ? MOVZXReg4Mem1 : MOVZXReg4Mem2,
+                             node,
+                             tempReg,
+                             generateX86MemoryReference(valueReg, indexReg, isCompressed ? 0 : 1, TR::Compiler->om.contiguousArrayHeaderSizeInBytes(), cg),
+                             cg);
+   generateRegRegInstruction(CMP4RegReg, node, tempReg, charReg, cg);
+   generateLabelInstruction(JE4, node, foundLabel, cg);
+   generateRegInstruction(INCReg(TR::Compiler->target.is64Bit()), node, indexReg, cg);
+   generateRegRegInstruction(CMP4RegReg, node, indexReg, endReg, cg);
+   generateLabelInstruction(JL4, node, SerialLoopLabel, cg);
+
+   generateLabelInstruction(LABEL, node, notFoundLabel, cg);
+   generateRegImmInstruction(MOV4RegImm4, node, resultReg, -1, cg);
+   generateLabelInstruction(JMP4, node, endLabel, cg);
+
+   // the lowest set mask bit is the byte offset of the first match within the vector
+   generateLabelInstruction(LABEL, node, SSEFoundLabel, cg);
+   generateRegRegInstruction(BSF4RegReg, node, tempReg, tempReg, cg);
+   if (!isCompressed)
+      generateRegImmInstruction(SHR4RegImm1, node, tempReg, 1, cg);
+   generateRegRegInstruction(ADDRegReg(), node, indexReg, tempReg, cg);
+
+   generateLabelInstruction(LABEL, node, foundLabel, cg);
+   generateRegRegInstruction(MOV4RegReg, node, resultReg, indexReg, cg);
+
+   TR::RegisterDependencyConditions  *dependencies = generateRegisterDependencyConditions((uint8_t)0, 9, cg);
+   dependencies->addPostCondition(valueReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(charReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(indexReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(endReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(resultReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(tempReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(maskReg, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(xmm0, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(xmm1, TR::RealRegister::NoReg, cg);
+   generateLabelInstruction(LABEL, node, endLabel, dependencies, cg);
+   node->setRegister(resultReg);
+   cg->decReferenceCount(valueNode);
+   cg->decReferenceCount(charNode);
+   cg->decReferenceCount(startNode);
+   cg->decReferenceCount(endNode);
+   cg->stopUsingRegister(tempReg);
+   cg->stopUsingRegister(maskReg);
+   cg->stopUsingRegister(indexReg);
+   cg->stopUsingRegister(xmm0);
+   cg->stopUsingRegister(xmm1);
+   return true;
+   }
+
 static void
 inlineDoubleWordCASSupportedCommon(
       TR::Node *node,
@@ -14159,6 +14339,13 @@ bool J9::X86::TreeEvaluator::VMinlineCallEvaluator(
                callWasInlined = inlineStringHashCode(node, isIndirect, cg);
             break;
             }
+         case TR::java_lang_String_indexOfImplCompressed:
+         case TR::java_lang_String_indexOfImplDecompressed:
+            {
+            if (!TR::Compiler->om.canGenerateArraylets())
+               callWasInlined = inlineStringIndexOf(node, isIndirect, resolvedMethodSymbol->getRecognizedMethod() == TR::java_lang_String_indexOfImplCompressed, cg);
+            break;
+            }
          case TR::java_util_concurrent_atomic_AtomicMarkableReference_doubleWordCAS:
             {
             callWasInlined = inlineAtomicMarkableReference_doubleWordCAS(node, cg);
@@ -15817,6 +16004,8 @@ J9::X86::TreeEvaluator::directCallEvaluator(TR::Node *node, TR::CodeGenerator *c
       case TR::sun_misc_Unsafe_copyMemory:
       case TR::java_lang_String_hashCodeImplCompressed:
       case TR::java_lang_String_hashCodeImplDecompressed:
+      case TR::java_lang_String_indexOfImplCompressed:
+      case TR::java_lang_String_indexOfImplDecompressed:
          if (TR::TreeEvaluator::VMinlineCallEvaluator(node, false, cg))
             {
             returnRegister = node->getRegister();
@@ -179,6 +179,17 @@ public:
 
 	bool _HeapManagementMXBeanBackCompatibilityEnabled;
 
+#if defined(J9VM_GC_VLHGC)
+	bool tarokEnableFullyConcurrentGMP; /**< If true, concurrent GMP keeps tracing until the mark work is drained instead of stopping after one increment's worth of scanning, leaving STW GMP increments only what concurrent marking could not keep up with */
+	UDATA tarokCopyForwardHotFieldDepth; /**< Maximum depth to which copy-forward follows JIT-identified hot fields, copying each hot child right behind its parent (0 disables hot field copying) */
+	bool tarokTrackNumaCopyTraffic; /**< If true, copy-forward counts bytes copied from and to regions on a NUMA node other than the copying thread's (set by -Xtgc:numa) */
+	UDATA tarokTargetPauseTimeMillis; /**< PGC pause time goal, in milliseconds, used to size Eden and the non-Eden collection set (0 if no goal was specified with -Xgc:targetPausetime=) */
+	struct {
+		U_64 _predictedTimeMicros; /**< Pause time, in microseconds, predicted for the most recent PGC when its Eden size was chosen */
+		U_64 _actualTimeMicros; /**< Measured pause time, in microseconds, of the most recent PGC (0 once reported by verbose GC) */
+	} tarokPGCPauseTimeStats;
+#endif /* J9VM_GC_VLHGC */
+
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
 #endif
@@ -294,11 +305,21 @@ public:
 		, _asyncCallbackKey(-1)
 		, _TLHAsyncCallbackKey(-1)
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
+#if defined(J9VM_GC_VLHGC)
+		, tarokEnableFullyConcurrentGMP(false)
+		, tarokCopyForwardHotFieldDepth(0)
+		, tarokTrackNumaCopyTraffic(false)
+		, tarokTargetPauseTimeMillis(0)
+#endif /* J9VM_GC_VLHGC */
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
 #endif
 	{
 		_typeId = __FUNCTION__;
+#if defined(J9VM_GC_VLHGC)
+		tarokPGCPauseTimeStats._predictedTimeMicros = 0;
+		tarokPGCPauseTimeStats._actualTimeMicros = 0;
+#endif /* J9VM_GC_VLHGC */
 	}
 };
 
@@ -514,6 +514,17 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 		}
 		if (try_scan(&scan_start, "tarokDisableConcurrentGMP")) {
 			extensions->tarokEnableConcurrentGMP = false;
+			extensions->tarokEnableFullyConcurrentGMP = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableFullyConcurrentGMP")) {
+			/* fully concurrent GMP is a mode of concurrent GMP so it implies it */
+			extensions->tarokEnableConcurrentGMP = true;
+			extensions->tarokEnableFullyConcurrentGMP = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableFullyConcurrentGMP")) {
+			extensions->tarokEnableFullyConcurrentGMP = false;
 			continue;
 		}
 		if (try_scan(&scan_start, "tarokEnableIncrementalClassGC")) {
@@ -540,6 +551,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableLeafFirstCopying = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokCopyForwardHotFieldDepth=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokCopyForwardHotFieldDepth), "tarokCopyForwardHotFieldDepth=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokEnableStableRegionDetection")) {
 			extensions->tarokEnableStableRegionDetection = true;
 			continue;
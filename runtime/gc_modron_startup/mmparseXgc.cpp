@@ -162,6 +162,14 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 
+	if (try_scan(scan_start, "overrideHiresTimerCheck")) {
+		extensions->overrideHiresTimerCheck = true;
+		goto _exit;
+	}
+
+#endif /* J9VM_GC_REALTIME */
+
+#if defined(J9VM_GC_REALTIME) || defined(J9VM_GC_VLHGC)
 	if (try_scan(scan_start, "targetPausetime=")) {
 		/* the unit of target pause time option is in milliseconds */
 		UDATA beatMilli = 0;
@@ -172,18 +180,18 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "targetPausetime=", (UDATA)0);
 			goto _error;
 		}
+#if defined(J9VM_GC_REALTIME)
 		/* convert the unit to microseconds and store in extensions */
 		extensions->beatMicro = beatMilli * 1000;
+#endif /* J9VM_GC_REALTIME */
+#if defined(J9VM_GC_VLHGC)
+		/* balanced uses the value as a pause time goal for sizing Eden and the PGC collection set */
+		extensions->tarokTargetPauseTimeMillis = beatMilli;
+#endif /* J9VM_GC_VLHGC */
 
 		goto _exit;
 	}
-
-	if (try_scan(scan_start, "overrideHiresTimerCheck")) {
-		extensions->overrideHiresTimerCheck = true;
-		goto _exit;
-	}
-
-#endif /* J9VM_GC_REALTIME */
+#endif /* J9VM_GC_REALTIME || J9VM_GC_VLHGC */
 
 //todo tempoary option to allow LOA to be enabled for testing with non-default gc policies
 //Remove once LOA code stable 
@@ -64,6 +64,12 @@ public:
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _hotFieldCopiedObjects; /**< The number of objects copied right behind their parent while following hot fields */
+
+	UDATA _numaRemoteSourceBytes; /**< Bytes copied out of regions on a NUMA node other than the copying thread's (regions and threads without node affinity are not counted) */
+	UDATA _numaRemoteDestinationBytes; /**< Bytes copied into regions on a NUMA node other than the copying thread's (regions and threads without node affinity are not counted) */
+	UDATA _numaRemoteScanCacheCount; /**< The number of scan caches taken from the scan list of a NUMA node other than the scanning thread's */
+
 private:
 	
 	/* 
@@ -87,6 +93,12 @@ public:
 
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
+
+		_hotFieldCopiedObjects = 0;
+
+		_numaRemoteSourceBytes = 0;
+		_numaRemoteDestinationBytes = 0;
+		_numaRemoteScanCacheCount = 0;
 	}
 	
 	/**
@@ -106,6 +118,12 @@ public:
 
 		_stringConstantsCleared += stats->_stringConstantsCleared;
 		_stringConstantsCandidates += stats->_stringConstantsCandidates;
+
+		_hotFieldCopiedObjects += stats->_hotFieldCopiedObjects;
+
+		_numaRemoteSourceBytes += stats->_numaRemoteSourceBytes;
+		_numaRemoteDestinationBytes += stats->_numaRemoteDestinationBytes;
+		_numaRemoteScanCacheCount += stats->_numaRemoteScanCacheCount;
 	}
 
 	MM_CopyForwardStats() :
@@ -119,6 +137,10 @@ public:
 		,_phantomReferenceStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
+		,_hotFieldCopiedObjects(0)
+		,_numaRemoteSourceBytes(0)
+		,_numaRemoteDestinationBytes(0)
+		,_numaRemoteScanCacheCount(0)
 	{}
 };
 
@@ -28,7 +28,9 @@
 #include "mmhook.h"
 
 #if defined(J9VM_GC_VLHGC)
+#include "CopyForwardStats.hpp"
 #include "EnvironmentBase.hpp"
+#include "EnvironmentVLHGC.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "HeapRegionIterator.hpp"
@@ -117,6 +119,43 @@ tgcHookReportNumaStatistics(J9HookInterface** hook, UDATA eventNum, void* eventD
 	}
 }
 
+/**
+ * Report cross-node copy-forward traffic at the end of each copy-forward (PGC)
+ */
+static void
+tgcHookReportNumaCopyForwardStatistics(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+	J9VMThread* vmThread = (J9VMThread*)event->currentThread->_language_vmthread;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vmThread->javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	MM_CopyForwardStats *copyForwardStats = (MM_CopyForwardStats *)event->copyForwardStats;
+
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		tgcExtensions->printf("NUMA CF: thread  node  remote-src-bytes  remote-dst-bytes  remote-caches\n");
+
+		GC_VMThreadListIterator threadIterator(vmThread);
+		J9VMThread *walkThread = NULL;
+		while (NULL != (walkThread = threadIterator.nextVMThread())) {
+			MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(walkThread);
+			if ((walkThread == vmThread) || (env->getThreadType() == GC_SLAVE_THREAD)) {
+				tgcExtensions->printf("NUMA CF: %6zu  %4zu  %16zu  %16zu  %13zu\n",
+						env->getSlaveID(),
+						env->getNumaAffinity(),
+						env->_copyForwardStats._numaRemoteSourceBytes,
+						env->_copyForwardStats._numaRemoteDestinationBytes,
+						env->_copyForwardStats._numaRemoteScanCacheCount);
+			}
+		}
+
+		UDATA copiedBytes = copyForwardStats->_copyBytesEden + copyForwardStats->_copyBytesNonEden;
+		tgcExtensions->printf("NUMA CF:  total        %16zu  %16zu  %13zu  (of %zu bytes copied)\n",
+				copyForwardStats->_numaRemoteSourceBytes,
+				copyForwardStats->_numaRemoteDestinationBytes,
+				copyForwardStats->_numaRemoteScanCacheCount,
+				copiedBytes);
+	}
+}
 
 /**
  * Initialise NUMA tgc tracing.
@@ -137,6 +176,11 @@ tgcNumaInitialize(J9JavaVM *javaVM)
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_END, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 
+	/* copy-forward only pays for counting cross-node traffic while it is being reported */
+	extensions->tarokTrackNumaCopyTraffic = true;
+	J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, tgcHookReportNumaCopyForwardStatistics, OMR_GET_CALLSITE(), NULL);
+
 	return result;
 }
 
@@ -28,6 +28,7 @@
 #include "CycleStateVLHGC.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
+#include "InterRegionRememberedSet.hpp"
 #include "MarkVLHGCStats.hpp"
 #include "ReferenceStats.hpp"
 #include "VerboseManager.hpp"
@@ -260,6 +261,15 @@ MM_VerboseHandlerOutputVLHGC::handleTaxationEntryPoint(J9HookInterface** hook, U
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
 	}	
 	writer->formatAndOutput(env, 0, "<allocation-taxation id=\"%zu\" taxation-threshold=\"%zu\" %s intervalms=\"%llu.%03llu\" />", manager->getIdAndIncrement(), event->taxationThreshold, tagTemplate, deltaTime / 1000 , deltaTime % 1000);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	U_64 actualTime = extensions->tarokPGCPauseTimeStats._actualTimeMicros;
+	if ((0 != extensions->tarokTargetPauseTimeMillis) && (0 != actualTime)) {
+		/* report how well the previous PGC met the pause time goal (only once, since taxation points also precede GMP-only increments) */
+		U_64 predictedTime = extensions->tarokPGCPauseTimeStats._predictedTimeMicros;
+		writer->formatAndOutput(env, 0, "<pause-time-goal targetms=\"%zu\" predictedms=\"%llu.%03llu\" actualms=\"%llu.%03llu\" />",
+				extensions->tarokTargetPauseTimeMillis, predictedTime / 1000, predictedTime % 1000, actualTime / 1000, actualTime % 1000);
+		extensions->tarokPGCPauseTimeStats._actualTimeMicros = 0;
+	}
 	writer->flush(env);
 	exitAtomicReportingBlock();
 }
@@ -356,6 +366,11 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 	writer->formatAndOutput(env, indent, "<remembered-set count=\"%zu\" freebytes=\"%zu\" totalbytes=\"%zu\" percent=\"%zu\" regionsoverflowed=\"%zu\" regionsstable=\"%zu\" regionsrebuilding=\"%zu\"/>",
 			stats->_rememberedSetCount, stats->_rememberedSetBytesFree, stats->_rememberedSetBytesTotal, rememberedSetFreePercent,
 			stats->_rememberedSetOverflowedRegionCount, stats->_rememberedSetStableRegionCount, stats->_rememberedSetBeingRebuiltRegionCount);
+
+	MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+	U_64 rebuildTime = interRegionRememberedSet->_lastRebuildTimeus;
+	writer->formatAndOutput(env, indent, "<remembered-set-overflow overflows=\"%zu\" lastrebuildms=\"%llu.%03llu\" />",
+			interRegionRememberedSet->_overflowEventCount, rebuildTime / 1000, rebuildTime % 1000);
 }
 
 void
@@ -400,6 +415,9 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				copyForwardStats->_copyObjectsNonEden, copyForwardStats->_copyBytesNonEden, copyForwardStats->_copyDiscardBytesNonEden);
 	writer->formatAndOutput(env, 1, "<memory-cardclean objects=\"%zu\" bytes=\"%zu\" />",
 				copyForwardStats->_objectsCardClean, copyForwardStats->_bytesCardClean);
+	if (0 != copyForwardStats->_hotFieldCopiedObjects) {
+		writer->formatAndOutput(env, 1, "<memory-copied-hot-fields objects=\"%zu\" />", copyForwardStats->_hotFieldCopiedObjects);
+	}
 	if(copyForwardStats->_aborted) {
 		writer->formatAndOutput(env, 1, "<memory-traced type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
 					copyForwardStats->_scanObjectsEden, copyForwardStats->_scanBytesEden);
@@ -856,6 +856,7 @@ MM_CopyForwardScheme::reinitCache(MM_EnvironmentVLHGC *env, MM_CopyScanCacheVLHG
 	Assert_MM_true(0.0 == cache->_allocationAgeSizeProduct);
 	
 	MM_HeapRegionDescriptorVLHGC * region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(cache->cacheBase);
+	cache->_numaNode = region->getNumaNode();
 	Trc_MM_CopyForwardScheme_reinitCache(env->getLanguageVMThread(), _regionManager->mapDescriptorToRegionTableIndex(region), cache,
 			region->getAllocationAgeSizeProduct() / (1024 * 1024) / (1024 * 1024), (double)((UDATA)cache->cacheAlloc - (UDATA)region->getLowAddress()) / (1024 * 1024));
 
@@ -2261,6 +2262,20 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
 				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
 
+				if (_extensions->tarokTrackNumaCopyTraffic) {
+					updateNumaCopyStats(env, sourceRegion, copyCache, objectCopySizeInBytes);
+				}
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+				if (0 != env->_copyForwardHotFieldDepth) {
+					/* this object is being copied as the hot child of an object copied by this thread */
+					env->_copyForwardStats._hotFieldCopiedObjects += 1;
+				}
+				if (0 != _extensions->tarokCopyForwardHotFieldDepth) {
+					copyHotFieldChildren(env, reservingContext, destinationObjectPtr);
+				}
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
 					copyLeafChildren(env, reservingContext, destinationObjectPtr);
@@ -2275,6 +2290,56 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 	return result;
 }
 
+void
+MM_CopyForwardScheme::updateNumaCopyStats(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *sourceRegion, MM_CopyScanCacheVLHGC *copyCache, UDATA objectCopySizeInBytes)
+{
+	/* node 0 means "no affinity" (for both threads and regions) so it can't be remote to anything */
+	UDATA threadNode = env->getNumaAffinity();
+	if (0 != threadNode) {
+		UDATA sourceNode = sourceRegion->getNumaNode();
+		UDATA destinationNode = copyCache->_numaNode;
+		if ((0 != sourceNode) && (threadNode != sourceNode)) {
+			env->_copyForwardStats._numaRemoteSourceBytes += objectCopySizeInBytes;
+		}
+		if ((0 != destinationNode) && (threadNode != destinationNode)) {
+			env->_copyForwardStats._numaRemoteDestinationBytes += objectCopySizeInBytes;
+		}
+	}
+}
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+void
+MM_CopyForwardScheme::copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr)
+{
+	if (env->_copyForwardHotFieldDepth < _extensions->tarokCopyForwardHotFieldDepth) {
+		J9Class *clazz = J9GC_J9OBJECT_CLAZZ(objectPtr);
+		UDATA instanceHotFieldDescription = clazz->instanceHotFieldDescription;
+		UDATA instanceDescription = (UDATA)clazz->instanceDescription;
+		/* The low bit of the hot field description requests hot field alignment instead, in which case the other bits are not hot fields.
+		 * Bit n (n > 0) marks the (n - 1)th reference slot as hot. As with leaf children, only immediate instance descriptions are supported,
+		 * which also lets us discard any hot bit that does not describe a reference slot of this class.
+		 */
+		if ((0 == (instanceHotFieldDescription & 1)) && (1 == (instanceDescription & 1))
+			&& (GC_ObjectModel::SCAN_MIXED_OBJECT == _extensions->objectModel.getScanType(clazz))
+		) {
+			UDATA hotBits = (instanceHotFieldDescription >> 1) & (instanceDescription >> 1);
+			fj9object_t* scanPtr = (fj9object_t*)( objectPtr + 1 );
+			env->_copyForwardHotFieldDepth += 1;
+			while (0 != hotBits) {
+				if(1 == (hotBits & 1)) {
+					/* Copy/Forward the slot reference (which recursively copies its own hot children) and perform any inter-region remember work that is required */
+					GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
+					copyAndForward(env, reservingContext, objectPtr, &slotObject);
+				}
+				hotBits >>= 1;
+				scanPtr += 1;
+			}
+			env->_copyForwardHotFieldDepth -= 1;
+		}
+	}
+}
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+
 #if defined(J9VM_GC_LEAF_BITS)
 void
 MM_CopyForwardScheme::copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr)
@@ -2855,6 +2920,9 @@ MM_CopyForwardScheme::getNextScanCache(MM_EnvironmentVLHGC *env, UDATA preferred
 			while ((NULL == cache) && (nextNode != preferredNumaNode)) {
 				if (COMMON_CONTEXT_INDEX != nextNode) {
 					cache = getNextScanCacheOnNode(env, nextNode);
+					if (NULL != cache) {
+						env->_copyForwardStats._numaRemoteScanCacheCount += 1;
+					}
 				}
 				nextNode = (nextNode + 1) % nodeLists;
 			}
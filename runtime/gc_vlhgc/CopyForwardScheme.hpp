@@ -933,6 +933,27 @@ private:
 	void copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
 #endif /* J9VM_GC_LEAF_BITS */
 
+	/**
+	 * Account for the NUMA traffic of a successful copy: bytes read from, and written to, regions on a node other than the copying thread's.
+	 * Only called when -Xtgc:numa has enabled tarokTrackNumaCopyTraffic.
+	 * @param env[in] the current (copying) thread
+	 * @param sourceRegion[in] the region the object was copied out of
+	 * @param copyCache[in] the copy cache the object was copied into
+	 * @param objectCopySizeInBytes[in] the number of bytes copied
+	 */
+	void updateNumaCopyStats(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *sourceRegion, MM_CopyScanCacheVLHGC *copyCache, UDATA objectCopySizeInBytes);
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+	/**
+	 * Copy the children referenced by the JIT-identified hot fields of the specified (just copied) object, so that they
+	 * are laid out right behind it. Hot children are followed depth first, up to tarokCopyForwardHotFieldDepth edges.
+	 * @param env[in] the current thread
+	 * @param reservingContext[in] The context to which we would prefer to copy any objects discovered in this method
+	 * @param objectPtr[in] the object whose hot children should be copied
+	 */
+	void copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+
 	/**
 	 * Calculate estimation for allocation age based on compact group and set it to the merged region
 	 * @param[in] env The current thread
@@ -37,6 +37,7 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(OMR_VMThread *omrVMThread)
 	,_deferredScanCache(NULL)
 	, _copyForwardCompactGroups(NULL)
 	, _previousConcurrentYieldCheckBytesScanned(0)
+	, _copyForwardHotFieldDepth(0)
 	, _rsclBufferControlBlockHead(NULL)
 	, _rsclBufferControlBlockTail(NULL)
 	, _rsclBufferControlBlockCount(0)
@@ -56,6 +57,7 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(J9JavaVM *javaVM)
 	,_deferredScanCache(NULL)
 	, _copyForwardCompactGroups(NULL)
 	, _previousConcurrentYieldCheckBytesScanned(0)
+	, _copyForwardHotFieldDepth(0)
 	, _rsclBufferControlBlockHead(NULL)
 	, _rsclBufferControlBlockTail(NULL)
 	, _rsclBufferControlBlockCount(0)
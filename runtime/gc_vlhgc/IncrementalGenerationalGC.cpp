@@ -106,6 +106,7 @@ MM_IncrementalGenerationalGC::MM_IncrementalGenerationalGC(MM_EnvironmentVLHGC *
 	, _persistentGlobalMarkPhaseState()
 	, _forceConcurrentTermination(false)
 	, _globalMarkPhaseIncrementBytesStillToScan(0)
+	, _globalMarkPhaseIncrementBytesToScan(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -424,7 +425,16 @@ MM_IncrementalGenerationalGC::globalMarkPhase(MM_EnvironmentVLHGC *env, bool inc
 
 	if (incrementalMark) {
 		reportGMPMarkStart(env);
-		I_64 endTime = j9time_current_time_millis() + _schedulingDelegate.currentGlobalMarkIncrementTimeMillis(env);
+		UDATA incrementTimeMillis = _schedulingDelegate.currentGlobalMarkIncrementTimeMillis(env);
+		if (_extensions->tarokEnableFullyConcurrentGMP
+			&& (MM_CycleState::state_process_work_packets_after_initial_mark == env->_cycleState->_markDelegateState)
+			&& (_globalMarkPhaseIncrementBytesStillToScan < _globalMarkPhaseIncrementBytesToScan)
+		) {
+			/* in fully concurrent mode, concurrent marking already did part of this increment's scanning so only spend the share of the pause needed for the remainder */
+			double remainingFraction = (double)_globalMarkPhaseIncrementBytesStillToScan / (double)_globalMarkPhaseIncrementBytesToScan;
+			incrementTimeMillis = OMR_MAX((UDATA)((double)incrementTimeMillis * remainingFraction), 1);
+		}
+		I_64 endTime = j9time_current_time_millis() + incrementTimeMillis;
 		if (env->_cycleState->_markDelegateState == MM_CycleState::state_mark_idle) {
 			_globalMarkDelegate.performMarkSetInitialState(env);
 		}
@@ -1037,6 +1047,7 @@ MM_IncrementalGenerationalGC::runGlobalMarkPhaseIncrement(MM_EnvironmentVLHGC *e
 	if (isGlobalMarkPhaseRunning()) {
 		/* the GMP is going to require another increment so allow concurrent to run */
 		_globalMarkPhaseIncrementBytesStillToScan = _schedulingDelegate.getBytesToScanInNextGMPIncrement(env);
+		_globalMarkPhaseIncrementBytesToScan = _globalMarkPhaseIncrementBytesStillToScan;
 	}
 }
 
@@ -1299,7 +1310,7 @@ MM_IncrementalGenerationalGC::partialGarbageCollectUsingCopyForward(MM_Environme
 	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._totalMemoryBefore = _extensions->getHeap()->getMemorySize();
 
 	if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
-		_projectedSurvivalCollectionSetDelegate.createRegionCollectionSetForPartialGC(env);
+		_projectedSurvivalCollectionSetDelegate.createRegionCollectionSetForPartialGC(env, _schedulingDelegate.getNonEdenCopyBudgetForPauseTimeGoal(env));
 	} else {
 		_collectionSetDelegate.createRegionCollectionSetForPartialGC(env);
 	}
@@ -1401,7 +1412,8 @@ MM_IncrementalGenerationalGC::partialGarbageCollectUsingMarkCompact(MM_Environme
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 	
 	if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
-		_projectedSurvivalCollectionSetDelegate.createRegionCollectionSetForPartialGC(env);
+		/* the pause time goal is modelled on copy-forward rates, so mark-compact PGCs are not constrained by it */
+		_projectedSurvivalCollectionSetDelegate.createRegionCollectionSetForPartialGC(env, UDATA_MAX);
 	} else {
 		_collectionSetDelegate.createRegionCollectionSetForPartialGC(env);
 	}
@@ -1998,7 +2010,8 @@ MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
 	bool isGMPRunning = isGlobalMarkPhaseRunning();
 	bool isProcessingWorkPackets = MM_CycleState::state_process_work_packets_after_initial_mark == _persistentGlobalMarkPhaseState._markDelegateState;
 	bool isStillPermittedToRun = !_forceConcurrentTermination;
-	bool isGMPWorkAvailable = _globalMarkPhaseIncrementBytesStillToScan > 0;
+	/* fully concurrent GMP keeps tracing past the next increment's scan target, until the work packets are drained */
+	bool isGMPWorkAvailable = _extensions->tarokEnableFullyConcurrentGMP || (_globalMarkPhaseIncrementBytesStillToScan > 0);
 	
 	return isConcurrentEnabled && isGMPRunning && isProcessingWorkPackets && isStillPermittedToRun && isGMPWorkAvailable;
 }
@@ -2038,7 +2051,8 @@ MM_IncrementalGenerationalGC::masterThreadConcurrentCollect(MM_EnvironmentBase *
 	 * flag to true if we want to interrupt it so that the master thread returns to the control mutex in order to receive a
 	 * new GC request.
 	 */
-	UDATA bytesConcurrentlyScanned = _globalMarkDelegate.performMarkConcurrent(env, _globalMarkPhaseIncrementBytesStillToScan, &_forceConcurrentTermination);
+	UDATA bytesToScan = _extensions->tarokEnableFullyConcurrentGMP ? UDATA_MAX : _globalMarkPhaseIncrementBytesStillToScan;
+	UDATA bytesConcurrentlyScanned = _globalMarkDelegate.performMarkConcurrent(env, bytesToScan, &_forceConcurrentTermination);
 	_globalMarkPhaseIncrementBytesStillToScan = MM_Math::saturatingSubtract(_globalMarkPhaseIncrementBytesStillToScan, bytesConcurrentlyScanned);
 	
 	/* Accumulate the mark increment stats into persistent GMP state*/
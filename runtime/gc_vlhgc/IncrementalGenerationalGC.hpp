@@ -109,6 +109,7 @@ private:
 	volatile bool _forceConcurrentTermination;	/**< Setting this to true will cause any concurrent GMP work being done for this collector to stop and return.  It is volatile because it is shared state between this and the concurren task's increment manager */
 	
 	UDATA _globalMarkPhaseIncrementBytesStillToScan;	/**< The number of bytes which must be scanned in the next GMP increment.  This is used by the concurrent GMP task to determine when it can terminate */
+	UDATA _globalMarkPhaseIncrementBytesToScan;	/**< The number of bytes the next GMP increment was asked to scan when it was scheduled (_globalMarkPhaseIncrementBytesStillToScan before any concurrent progress) */
 
 private:
 	/* hook routines to be called on AF start and End */
@@ -60,6 +60,9 @@ MM_InterRegionRememberedSet::MM_InterRegionRememberedSet(MM_HeapRegionManager *h
 	, _overflowedRegionCount(0)
 	, _stableRegionCount(0)
 	, _beingRebuiltRegionCount(0)
+	, _overflowEventCount(0)
+	, _rebuildStartTime(0)
+	, _lastRebuildTimeus(0)
 	, _unusedRegionThreshold(0.0)
 	, _regionTable(NULL)
 	, _tableDescriptorSize(0)
@@ -512,6 +515,7 @@ MM_InterRegionRememberedSet::enqueueOverflowedRscl(MM_EnvironmentVLHGC *env, MM_
 {
 	/* have to use atomic update, since other overflowed RSCLs can be updating it concurrently */
 	MM_AtomicOperations::add(&_overflowedRegionCount, 1);
+	MM_AtomicOperations::add(&_overflowEventCount, 1);
 
 	rsclToEnqueue->_nonEmptyOverflowedNext = NULL;
 	/* make sure rsclToEnqueue->_nonEmptyOverflowedNext does not point to a stale RSCL before we make it visible to the other users of the list */
@@ -616,7 +620,9 @@ MM_InterRegionRememberedSet::prepareOverflowedRegionsForRebuilding(MM_Environmen
 {
 	/* do not need to call this for global GC - it rebuilds all RSCLs */
 	if (MM_CycleState::CT_GLOBAL_MARK_PHASE == env->_cycleState->_collectionType) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
 		Assert_MM_true(0 == _beingRebuiltRegionCount);
+		_rebuildStartTime = j9time_hires_clock();
 		for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
 			MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->physicalTableDescriptorForIndex(index);
 			Assert_MM_false(region->getRememberedSetCardList()->isBeingRebuilt());
@@ -657,6 +663,12 @@ MM_InterRegionRememberedSet::setRegionsAsRebuildingComplete(MM_EnvironmentVLHGC
 		}
 	}
 
+	if (0 != _rebuildStartTime) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		_lastRebuildTimeus = j9time_hires_delta(_rebuildStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		_rebuildStartTime = 0;
+	}
+
 	Trc_MM_InterRegionRememberedSet_setRegionsAsRebuildingComplete_rebuildingSummary(env->getLanguageVMThread(), beingRebuiltCount, stillOverflowedCount);
 	Assert_MM_true(0 == _beingRebuiltRegionCount);
 }
@@ -906,49 +918,12 @@ void
 MM_InterRegionRememberedSet::clearFromRegionReferencesForMarkDirect(MM_EnvironmentVLHGC* env)
 {
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
-	MM_CardTable *cardTable = MM_GCExtensions::getExtensions(env)->cardTable;
 	U_64 startTime = j9time_hires_clock();
 
-	GC_HeapRegionIteratorVLHGC regionIterator(_heapRegionManager);
-	MM_HeapRegionDescriptorVLHGC *region;
-
 	UDATA cardsProcessed = 0;
 	UDATA cardsRemoved = 0;
 
-	while (NULL != (region = regionIterator.nextRegion())) {
-		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			if (!region->getRememberedSetCardList()->isOverflowed()) {
-				MM_RememberedSetCard card = 0;
-				UDATA toRemoveCount = 0;
-				UDATA totalCountBefore = 0;
-				GC_RememberedSetCardListCardIterator rsclCardIterator(region->getRememberedSetCardList());
-				while(0 != (card = rsclCardIterator.nextReferencingCard(env))) {
-					MM_HeapRegionDescriptorVLHGC *fromRegion = tableDescriptorForRememberedSetCard(card);
-					Card * cardAddress = rememberedSetCardToCardAddr(env, card);
-					/* Regions that are completely swept after a GMP, might still have outgoing references (thus we consider empty regions too) */
-					if (fromRegion->_markData._shouldMark  || !fromRegion->containsObjects() || isDirtyCardForPartialCollect(env, cardTable, cardAddress)) {
-						toRemoveCount += 1;
-						rsclCardIterator.removeCurrentCard();
-					}
-					totalCountBefore +=1;
-				}
-
-				if (0 != toRemoveCount) {
-					region->getRememberedSetCardList()->compact(env);
-					UDATA totalCountAfter = region->getRememberedSetCardList()->getSize(env);
-
-					Trc_MM_InterRegionRememberedSet_clearFromRegionReferencesForMark_cardCounts(env->getLanguageVMThread(), MM_GCExtensions::getExtensions(env)->globalVLHGCStats.gcCount, _heapRegionManager->mapDescriptorToRegionTableIndex(region), totalCountBefore, toRemoveCount, totalCountAfter);
-					Assert_MM_true(totalCountBefore == toRemoveCount + totalCountAfter);
-				}
-
-				cardsProcessed += totalCountBefore;
-				cardsRemoved += toRemoveCount;
-
-			} else {
-				region->getRememberedSetCardList()->releaseBuffers(env);
-			}
-		}
-	}
+	clearRegionsFromRegionReferencesForMark(env, false, &cardsProcessed, &cardsRemoved);
 
 	env->_irrsStats._clearFromRegionReferencesTimesus = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
 	env->_irrsStats._clearFromRegionReferencesCardsProcessed = cardsProcessed;
@@ -961,79 +936,116 @@ void
 MM_InterRegionRememberedSet::clearFromRegionReferencesForMarkOptimized(MM_EnvironmentVLHGC* env)
 {
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
-	MM_CardTable *cardTable = MM_GCExtensions::getExtensions(env)->cardTable;
-	MM_CompressedCardTable *compressedCardTable = MM_GCExtensions::getExtensions(env)->compressedCardTable;
 	U_64 startTime = j9time_hires_clock();
 
 	rebuildCompressedCardTableForMark(env);
 
 	U_64 timeAfterRebuild = j9time_hires_clock();
 
-	GC_HeapRegionIteratorVLHGC regionIterator(_heapRegionManager);
-	MM_HeapRegionDescriptorVLHGC *region;
-
 	UDATA cardsProcessed = 0;
 	UDATA cardsRemoved = 0;
+
+	clearRegionsFromRegionReferencesForMark(env, true, &cardsProcessed, &cardsRemoved);
+
+	env->_irrsStats._clearFromRegionReferencesTimesus = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	env->_irrsStats._rebuildCompressedCardTableTimesus = j9time_hires_delta(startTime, timeAfterRebuild, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	env->_irrsStats._clearFromRegionReferencesCardsProcessed = cardsProcessed;
+	env->_irrsStats._clearFromRegionReferencesCardsCleared = cardsRemoved;
+
+	Trc_MM_InterRegionRememberedSet_clearFromRegionReferencesForMark_timesus(env->getLanguageVMThread(), env->_irrsStats._clearFromRegionReferencesTimesus, env->_irrsStats._rebuildCompressedCardTableTimesus);
+}
+
+void
+MM_InterRegionRememberedSet::clearRegionsFromRegionReferencesForMark(MM_EnvironmentVLHGC* env, bool useCompressedCardTable, UDATA *cardsProcessed, UDATA *cardsRemoved)
+{
+	GC_HeapRegionIteratorVLHGC regionIterator(_heapRegionManager);
+	MM_HeapRegionDescriptorVLHGC *region = NULL;
 	bool tableIsReady = false;
 
+	/* first pass: one work unit per region. Large lists are only flagged here and left for the second pass */
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			if (!region->getRememberedSetCardList()->isOverflowed()) {
-				MM_RememberedSetCard card = 0;
-				UDATA toRemoveCount = 0;
-				UDATA totalCountBefore = 0;
-				GC_RememberedSetCardListCardIterator rsclCardIterator(region->getRememberedSetCardList());
-				while(0 != (card = rsclCardIterator.nextReferencingCard(env))) {
-					/* Regions that are completely swept after a GMP, might still have outgoing references (thus we consider empty regions too) */
-					bool remove = true;
-					if (tableIsReady) {
-						/* Rebuild of Compressed Card Table has been completed - use it */
-						remove = compressedCardTable->isCompressedCardDirtyForPartialCollect(env, convertHeapAddressFromRememberedSetCard(card));
-					} else {
-						if (compressedCardTable->isReady()) {
-							tableIsReady = true;
-							/* Rebuild of Compressed Card Table has been completed - use it for first time */
-							remove = compressedCardTable->isCompressedCardDirtyForPartialCollect(env, convertHeapAddressFromRememberedSetCard(card));
-						} else {
-							/* rebuild is not complete - look at the region PGC selection and card itself directly */
-							MM_HeapRegionDescriptorVLHGC *fromRegion = tableDescriptorForRememberedSetCard(card);
-							if (fromRegion->containsObjects() && !fromRegion->_markData._shouldMark) {
-								Card * cardAddress = rememberedSetCardToCardAddr(env, card);
-								remove = isDirtyCardForPartialCollect(env, cardTable, cardAddress);
-							}
-						}
-					}
+			MM_RememberedSetCardList *rscl = region->getRememberedSetCardList();
+			rscl->_clearByBucket = false;
+			if (rscl->isOverflowed()) {
+				rscl->releaseBuffers(env);
+			} else if (rscl->getBufferCount() > RSCL_CLEAR_BY_BUCKET_BUFFER_THRESHOLD) {
+				rscl->_clearByBucket = true;
+			} else {
+				clearCardsFromRegionReferencesForMark(env, region, NULL, useCompressedCardTable, &tableIsReady, cardsProcessed, cardsRemoved);
+			}
+		}
+	}
 
-					if (remove) {
-						toRemoveCount += 1;
-						rsclCardIterator.removeCurrentCard();
-					}
-					totalCountBefore +=1;
-				}
+	/* all threads have to agree on which lists were flagged before the bucket work units can be handed out */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
 
-				if (0 != toRemoveCount) {
-					region->getRememberedSetCardList()->compact(env);
-					UDATA totalCountAfter = region->getRememberedSetCardList()->getSize(env);
-					
-					Trc_MM_InterRegionRememberedSet_clearFromRegionReferencesForMark_cardCounts(env->getLanguageVMThread(), MM_GCExtensions::getExtensions(env)->globalVLHGCStats.gcCount, _heapRegionManager->mapDescriptorToRegionTableIndex(region), totalCountBefore, toRemoveCount, totalCountAfter);
-					Assert_MM_true(totalCountBefore == toRemoveCount + totalCountAfter);
+	/* second pass: one work unit per bucket of each flagged list. Buckets are compacted independently, so the threads do not need to coordinate on a list */
+	GC_HeapRegionIteratorVLHGC bucketRegionIterator(_heapRegionManager);
+	while (NULL != (region = bucketRegionIterator.nextRegion())) {
+		MM_RememberedSetCardList *rscl = region->getRememberedSetCardList();
+		if (rscl->_clearByBucket) {
+			MM_RememberedSetCardBucket *bucket = rscl->_bucketListHead;
+			while (NULL != bucket) {
+				if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					clearCardsFromRegionReferencesForMark(env, region, bucket, useCompressedCardTable, &tableIsReady, cardsProcessed, cardsRemoved);
 				}
+				bucket = bucket->_next;
+			}
+		}
+	}
+}
 
-				cardsProcessed += totalCountBefore;
-				cardsRemoved += toRemoveCount;
-
-			} else {
-				region->getRememberedSetCardList()->releaseBuffers(env);
+void
+MM_InterRegionRememberedSet::clearCardsFromRegionReferencesForMark(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region, MM_RememberedSetCardBucket *bucket, bool useCompressedCardTable, bool *tableIsReady, UDATA *cardsProcessed, UDATA *cardsRemoved)
+{
+	MM_CardTable *cardTable = MM_GCExtensions::getExtensions(env)->cardTable;
+	MM_CompressedCardTable *compressedCardTable = MM_GCExtensions::getExtensions(env)->compressedCardTable;
+	MM_RememberedSetCardList *rscl = region->getRememberedSetCardList();
+
+	MM_RememberedSetCard card = 0;
+	UDATA toRemoveCount = 0;
+	UDATA totalCountBefore = 0;
+	GC_RememberedSetCardListCardIterator rsclCardIterator = (NULL == bucket) ? GC_RememberedSetCardListCardIterator(rscl) : GC_RememberedSetCardListCardIterator(rscl, bucket);
+	while(0 != (card = rsclCardIterator.nextReferencingCard(env))) {
+		bool remove = true;
+		if (useCompressedCardTable && (*tableIsReady || compressedCardTable->isReady())) {
+			/* Rebuild of Compressed Card Table has been completed - use it */
+			*tableIsReady = true;
+			remove = compressedCardTable->isCompressedCardDirtyForPartialCollect(env, convertHeapAddressFromRememberedSetCard(card));
+		} else {
+			/* look at the region PGC selection and card itself directly */
+			MM_HeapRegionDescriptorVLHGC *fromRegion = tableDescriptorForRememberedSetCard(card);
+			/* Regions that are completely swept after a GMP, might still have outgoing references (thus we consider empty regions too) */
+			if (fromRegion->containsObjects() && !fromRegion->_markData._shouldMark) {
+				Card * cardAddress = rememberedSetCardToCardAddr(env, card);
+				remove = isDirtyCardForPartialCollect(env, cardTable, cardAddress);
 			}
 		}
+
+		if (remove) {
+			toRemoveCount += 1;
+			rsclCardIterator.removeCurrentCard();
+		}
+		totalCountBefore +=1;
 	}
 
-	env->_irrsStats._clearFromRegionReferencesTimesus = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
-	env->_irrsStats._rebuildCompressedCardTableTimesus = j9time_hires_delta(startTime, timeAfterRebuild, J9PORT_TIME_DELTA_IN_MICROSECONDS);
-	env->_irrsStats._clearFromRegionReferencesCardsProcessed = cardsProcessed;
-	env->_irrsStats._clearFromRegionReferencesCardsCleared = cardsRemoved;
+	if (0 != toRemoveCount) {
+		UDATA totalCountAfter = 0;
+		if (NULL == bucket) {
+			rscl->compact(env);
+			totalCountAfter = rscl->getSize(env);
+		} else {
+			bucket->compact(env);
+			totalCountAfter = bucket->getSize(env);
+		}
 
-	Trc_MM_InterRegionRememberedSet_clearFromRegionReferencesForMark_timesus(env->getLanguageVMThread(), env->_irrsStats._clearFromRegionReferencesTimesus, env->_irrsStats._rebuildCompressedCardTableTimesus);
+		Trc_MM_InterRegionRememberedSet_clearFromRegionReferencesForMark_cardCounts(env->getLanguageVMThread(), MM_GCExtensions::getExtensions(env)->globalVLHGCStats.gcCount, _heapRegionManager->mapDescriptorToRegionTableIndex(region), totalCountBefore, toRemoveCount, totalCountAfter);
+		Assert_MM_true(totalCountBefore == toRemoveCount + totalCountAfter);
+	}
+
+	*cardsProcessed += totalCountBefore;
+	*cardsRemoved += toRemoveCount;
 }
 
 void
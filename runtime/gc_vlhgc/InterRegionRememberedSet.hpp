@@ -45,6 +45,9 @@ class MM_CollectionStatisticsVLHGC;
 /* value for MAX_LOCAL_RSCL_BUFFER_POOL_SIZE is empirically chosen to be the lowest one but still reduces most of contention on global pool lock */
 #define MAX_LOCAL_RSCL_BUFFER_POOL_SIZE 16
 
+/* RSCLs holding more buffers than this are cleared bucket by bucket (rather than as a single work unit), so that one large list does not serialize the clearing phase */
+#define RSCL_CLEAR_BY_BUCKET_BUFFER_THRESHOLD 64
+
 
 class MM_InterRegionRememberedSet : public MM_BaseVirtual
 {
@@ -70,6 +73,9 @@ public:
 	volatile UDATA _overflowedRegionCount;					/**< count of regions overflowed as full */
 	UDATA _stableRegionCount;								/**< count of regions overflowed as stable */
 	volatile UDATA _beingRebuiltRegionCount;				/**< count of overflowed regions currently being rebuilt */
+	volatile UDATA _overflowEventCount;						/**< total count of RSCLs overflowed as full since startup (stable region overflows are not included) */
+	U_64 _rebuildStartTime;									/**< hires time at which overflowed RSCLs were last set as being rebuilt, 0 if no rebuild is in progress */
+	U_64 _lastRebuildTimeus;								/**< duration (in microseconds) of the last completed RSCL rebuild (from the start of the GMP to its completion) */
 	double _unusedRegionThreshold;							/**< fraction of region unused (free&fragmented) to be considered full (used for stable region detection) */
 
 	MM_HeapRegionDescriptor *_regionTable;					/**< cached copy of regionTable (from HeapRegionManager) */
@@ -169,6 +175,29 @@ private:
 	 */
 	void clearFromRegionReferencesForMarkOptimized(MM_EnvironmentVLHGC* env);
 
+	/**
+	 * Clears references from Collection Set and from dirty cards for all non-overflowed RSCLs (multithreaded).
+	 * Small RSCLs are processed one region per work unit. Large RSCLs are processed one bucket per work unit, in a second pass,
+	 * so that they are shared between the GC threads.
+	 * @param env current thread environment
+	 * @param useCompressedCardTable true if the compressed card table (once its rebuild completes) should be used to find dirty cards
+	 * @param cardsProcessed[out] incremented by the count of cards visited by this thread
+	 * @param cardsRemoved[out] incremented by the count of cards removed by this thread
+	 */
+	void clearRegionsFromRegionReferencesForMark(MM_EnvironmentVLHGC* env, bool useCompressedCardTable, UDATA *cardsProcessed, UDATA *cardsRemoved);
+
+	/**
+	 * Clears references from Collection Set and from dirty cards for one RSCL, or one bucket of it
+	 * @param env current thread environment
+	 * @param region the region owning the RSCL to clear
+	 * @param bucket the bucket of the RSCL to clear, or NULL to clear all the buckets
+	 * @param useCompressedCardTable true if the compressed card table (once its rebuild completes) should be used to find dirty cards
+	 * @param tableIsReady[in/out] true once this thread has observed the compressed card table rebuild complete
+	 * @param cardsProcessed[out] incremented by the count of cards visited
+	 * @param cardsRemoved[out] incremented by the count of cards removed
+	 */
+	void clearCardsFromRegionReferencesForMark(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region, MM_RememberedSetCardBucket *bucket, bool useCompressedCardTable, bool *tableIsReady, UDATA *cardsProcessed, UDATA *cardsRemoved);
+
 	/**
 	 * Clears references from Compaction Set and from dirty cards
 	 * without using of compressed card table
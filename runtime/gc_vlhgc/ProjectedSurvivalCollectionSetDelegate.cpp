@@ -57,6 +57,7 @@ MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDele
 	, _setSelectionDataTable(NULL)
 	, _dynamicSelectionList(NULL)
 	, _dynamicSelectionRegionList(NULL)
+	, _nonNurseryCopyBudgetRemaining(UDATA_MAX)
 {
 	_typeId = __FUNCTION__;
 }
@@ -298,6 +299,14 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(MM_En
 		double projectedReclaimableBytesFraction = (double)projectedReclaimableBytes / (double)regionSize;
 
 		if (projectedReclaimableBytesFraction > _extensions->tarokCopyForwardFragmentationTarget) {
+			/* stop once the survivors we expect to copy out of the selected regions would exceed the pause time budget */
+			UDATA projectedCopyBytes = regionSize - projectedReclaimableBytes;
+			if (UDATA_MAX != _nonNurseryCopyBudgetRemaining) {
+				if (projectedCopyBytes > _nonNurseryCopyBudgetRemaining) {
+					break;
+				}
+				_nonNurseryCopyBudgetRemaining -= projectedCopyBytes;
+			}
 			selectRegion(env, region);
 			_setSelectionDataTable[compactGroup]._dynamicSelectionThisCycle = true;
 			regionBudget -= 1;
@@ -345,6 +354,10 @@ MM_ProjectedSurvivalCollectionSetDelegate::createCoreSamplingCollectionSet(MM_En
 	} else {
 		regionBudget = (UDATA)(nurseryRegionCount * _extensions->tarokCoreSamplingPercentageBudget);
 	}
+	if (UDATA_MAX != _nonNurseryCopyBudgetRemaining) {
+		/* nothing is known about the survival of sampled regions, so assume each one is copied in full */
+		regionBudget = OMR_MIN(regionBudget, _nonNurseryCopyBudgetRemaining / _regionManager->getRegionSize());
+	}
 
 	Trc_MM_CollectionSetDelegate_createRegionCollectionSetForPartialGC_coreSamplingBudget(
 		env->getLanguageVMThread(),
@@ -397,10 +410,12 @@ MM_ProjectedSurvivalCollectionSetDelegate::createCoreSamplingCollectionSet(MM_En
 }
 
 void
-MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPartialGC(MM_EnvironmentVLHGC *env)
+MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPartialGC(MM_EnvironmentVLHGC *env, UDATA nonNurseryCopyBudget)
 {
 	Assert_MM_true(MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType);
 
+	_nonNurseryCopyBudgetRemaining = nonNurseryCopyBudget;
+
 	bool dynamicCollectionSet = _extensions->tarokEnableDynamicCollectionSetSelection;
 
 	/* If dynamic collection sets are enabled, reset all related data structures that are used for selection */
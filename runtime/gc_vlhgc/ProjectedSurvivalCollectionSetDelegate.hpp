@@ -133,6 +133,8 @@ private:
 
 	MM_HeapRegionDescriptorVLHGC **_dynamicSelectionRegionList;  /**< Pointer table used for sorting or iterating over regions */
 
+	UDATA _nonNurseryCopyBudgetRemaining; /**< Bytes that non-nursery regions selected for the current PGC may still be expected to copy (UDATA_MAX if unconstrained) */
+
 protected:
 public:
 
@@ -231,8 +233,9 @@ public:
 	 * Build the internal representation of the set of regions that are to be collected for this cycle.
 	 * This should only be called during a partial garbage collect.
 	 * @param env[in] The master GC thread
+	 * @param nonNurseryCopyBudget[in] The number of bytes the regions selected outside of the nursery may be expected to copy (UDATA_MAX if unconstrained)
 	 */
-	void createRegionCollectionSetForPartialGC(MM_EnvironmentVLHGC *env);
+	void createRegionCollectionSetForPartialGC(MM_EnvironmentVLHGC *env, UDATA nonNurseryCopyBudget);
 
 	/**
 	 * Delete the internal representation of the set of regions that participated in the collection cycle.
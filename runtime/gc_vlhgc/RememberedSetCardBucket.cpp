@@ -256,7 +256,8 @@ MM_RememberedSetCardBucket::compact(MM_EnvironmentVLHGC *env)
 		UDATA releasedCount = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet->releaseCardBufferControlBlockListToLocalPool(env, toDeleteCardBufferControlBlock, UDATA_MAX);
 		Assert_MM_true(releasedCount <= _bufferCount);
 		_bufferCount -= releasedCount;
-		_rscl->_bufferCount -= releasedCount;
+		/* other buckets of the same list may be compacted concurrently */
+		MM_AtomicOperations::subtract(&_rscl->_bufferCount, releasedCount);
 	}
 	
 	Assert_MM_true(_rscl->_bufferCount >= _bufferCount);
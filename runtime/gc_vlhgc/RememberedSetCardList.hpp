@@ -49,6 +49,7 @@ private:
 	bool _beingRebuilt;										/**< the list is being rebuilt. thus, it is incomplete and should not be used, yet */
 	bool _stable;											/**< if true, list is overflowed due to region being stable */
 	volatile UDATA _bufferCount;										/**< count of buffers in all buckets' lists */
+	bool _clearByBucket;									/**< set while clearing from region references if the list is large enough to be cleared one bucket per work unit */
 	MM_RememberedSetCardList * volatile _nonEmptyOverflowedNext; 		/**< overflowed RSCL found during a GC cycle are linked into a single liked list - this is next pointer */
 private:
 	/**
@@ -190,6 +191,7 @@ public:
 	  , _beingRebuilt(false)
 	  , _stable(false)
 	  , _bufferCount(0)
+	  , _clearByBucket(false)
 	  , _nonEmptyOverflowedNext(NULL)
 	{
 		_typeId = __FUNCTION__;
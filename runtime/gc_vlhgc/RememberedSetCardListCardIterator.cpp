@@ -53,11 +53,11 @@ GC_RememberedSetCardListCardIterator::nextBucket(MM_EnvironmentBase* env)
 	/* next bucket in the list */
 	do {
 		if (NULL == _currentBucket) {
-			_currentBucket = _rscl->_bucketListHead;
+			_currentBucket = _firstBucket;
 		} else {
 			_currentBucket = _currentBucket->_next;
 		}
-		if (NULL == _currentBucket) {
+		if (_lastBucket == _currentBucket) {
 			/* this was the last bucket */
 			return false;
 		}
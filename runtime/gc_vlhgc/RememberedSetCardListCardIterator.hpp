@@ -36,6 +36,8 @@ private:
 	MM_RememberedSetCardList *_rscl; /**< RememberedSetCardList being iterated */
 
 	MM_RememberedSetCardBucket *_currentBucket;				/**< current bucket pointer */
+	MM_RememberedSetCardBucket *_firstBucket;				/**< first bucket to iterate */
+	MM_RememberedSetCardBucket *_lastBucket;				/**< bucket at which iteration stops (exclusive), NULL to iterate to the end of the list */
 	MM_RememberedSetCard *_bufferCardList; /**< current buffer */
 	MM_CardBufferControlBlock *_cardBufferControlBlockNext; /**< next buffer control block */
 	UDATA _cardIndex; 				/**< The card index in the RSCL */
@@ -63,6 +65,25 @@ public:
 	GC_RememberedSetCardListCardIterator(MM_RememberedSetCardList *rscl, bool skipOverflowedBuckets = true)
 		: _rscl(rscl)
 		, _currentBucket(NULL)
+		, _firstBucket(rscl->_bucketListHead)
+		, _lastBucket(NULL)
+		, _bufferCardList(NULL)
+		, _cardBufferControlBlockNext(NULL)
+		, _cardIndex(MM_RememberedSetCardBucket::MAX_BUFFER_SIZE)
+		, _cardIndexTop(MM_RememberedSetCardBucket::MAX_BUFFER_SIZE)
+		{}
+
+	/**
+	 * Construct a CardList Iterator restricted to a single bucket of a given CardList
+	 *
+	 * @param rscl CardList being iterated
+	 * @param bucket the bucket (owned by rscl) to iterate
+	 */
+	GC_RememberedSetCardListCardIterator(MM_RememberedSetCardList *rscl, MM_RememberedSetCardBucket *bucket)
+		: _rscl(rscl)
+		, _currentBucket(NULL)
+		, _firstBucket(bucket)
+		, _lastBucket(bucket->_next)
 		, _bufferCardList(NULL)
 		, _cardBufferControlBlockNext(NULL)
 		, _cardIndex(MM_RememberedSetCardBucket::MAX_BUFFER_SIZE)
@@ -99,6 +99,9 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _historicBytesScannedConcurrentlyPerGMP(0)
 	, _partialGcStartTime(0)
 	, _historicalPartialGCTime(0)
+	, _copyForwardTimeMicros(0)
+	, _averagePGCOverheadMillis(0.0)
+	, _predictedPGCTimeMillis(0.0)
 	, _dynamicGlobalMarkIncrementTimeMillis(50)
 	, _scanRateStats()
 {
@@ -280,6 +283,19 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 		if (copyForwardStats->_aborted && (0 ==_remainingGMPIntermissionIntervals)) {
 			_disableCopyForwardDuringCurrentGlobalMarkPhase = true;
 		}
+
+		if (!copyForwardStats->_aborted && (0 != _copyForwardTimeMicros)) {
+			/* everything in this PGC other than the copy-forward itself (root scanning, card cleaning, RSCL processing) is treated as fixed overhead */
+			U_64 elapsedMicros = j9time_hires_delta(_partialGcStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+			if (elapsedMicros >= _copyForwardTimeMicros) {
+				double overheadMillis = (double)(elapsedMicros - _copyForwardTimeMicros) / 1000.0;
+				if (0.0 == _averagePGCOverheadMillis) {
+					_averagePGCOverheadMillis = overheadMillis;
+				} else {
+					_averagePGCOverheadMillis = (_averagePGCOverheadMillis * partialGCTimeHistoricWeight) + (overheadMillis * (1.0 - partialGCTimeHistoricWeight));
+				}
+			}
+		}
 	} else {
 		/* measure scan rate in PGC, only if we did M/S/C collect */
 		measureScanRate(env, measureScanRateHistoricWeightForPGC);
@@ -287,6 +303,8 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 
 	measureConsumptionForPartialGC(env, reclaimableRegions, defragmentReclaimableRegions);
 	calculateAutomaticGMPIntermission(env);
+	/* remember what was predicted for this PGC before predicting the next one */
+	double predictedPGCTimeMillis = _predictedPGCTimeMillis;
 	calculateEdenSize(env);
 	
 	estimateMacroDefragmentationWork(env);
@@ -294,10 +312,18 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 	/* Calculate the time spent in the current Partial GC */
 	U_64 partialGcEndTime = j9time_hires_clock();
 	U_64 pgcTime = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MILLISECONDS);
+	U_64 pgcTimeMicros = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
 	/* Clear the start time to be clear that we've used it */
 	_partialGcStartTime = 0;
 	calculateGlobalMarkIncrementTimeMillis(env, pgcTime);
 
+	if ((0 != _extensions->tarokTargetPauseTimeMillis) && env->_cycleState->_shouldRunCopyForward) {
+		/* published for verbose GC, which reports predicted versus actual pause at the next taxation point */
+		_extensions->tarokPGCPauseTimeStats._predictedTimeMicros = (U_64)(predictedPGCTimeMillis * 1000.0);
+		_extensions->tarokPGCPauseTimeStats._actualTimeMicros = pgcTimeMicros;
+	}
+	_copyForwardTimeMicros = 0;
+
 	TRIGGER_J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED(
 		_extensions->privateHookInterface,
 		env->getOmrVMThread(),
@@ -833,6 +859,7 @@ MM_SchedulingDelegate::firstPGCAfterGMPCompleted()
 void
 MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 {
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
 	MM_CopyForwardStats * copyForwardStats = &(static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats);
 	UDATA bytesCopied = copyForwardStats->_copyBytesTotal;
 	UDATA bytesDiscarded = copyForwardStats->_copyDiscardBytesTotal;
@@ -852,6 +879,7 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 	
 	_averageSurvivorSetRegionCount = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
 	_averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+	_copyForwardTimeMicros = j9time_hires_delta(copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
 
 	Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(
 		env->getLanguageVMThread(),
@@ -950,6 +978,11 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	Assert_MM_true(edenMaximumCount >= edenMinimumCount);
 	
 	UDATA desiredEdenCount = freeRegions;
+	/* with a pause time goal, never plan an Eden we expect to take longer than the goal to collect */
+	UDATA pauseTimeEdenCount = calculateEdenRegionCountForPauseTimeGoal(env);
+	if (pauseTimeEdenCount < edenMaximumCount) {
+		edenMaximumCount = OMR_MAX(pauseTimeEdenCount, edenMinimumCount);
+	}
 	if (desiredEdenCount > edenMaximumCount) {
 		desiredEdenCount = edenMaximumCount;
 	} else if (desiredEdenCount < edenMinimumCount) {
@@ -965,9 +998,72 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 		_edenRegionCount = freeRegions;
 		Trc_MM_SchedulingDelegate_calculateEdenSize_reduceToFreeBytes(env->getLanguageVMThread(), desiredEdenCount, _edenRegionCount);
 	}
+	_predictedPGCTimeMillis = predictPartialGCTimeMillis(_edenRegionCount);
 	Trc_MM_SchedulingDelegate_calculateEdenSize_Exit(env->getLanguageVMThread(), (_edenRegionCount * regionSize));
 }
 
+double
+MM_SchedulingDelegate::estimateCopyForwardTimeMillis(double bytesToCopy) const
+{
+	/* _averageCopyForwardRate is measured in bytes per microsecond */
+	double copyForwardRate = OMR_MAX(_averageCopyForwardRate, 1.0);
+	return bytesToCopy / copyForwardRate / 1000.0;
+}
+
+double
+MM_SchedulingDelegate::predictPartialGCTimeMillis(UDATA edenRegionCount) const
+{
+	UDATA regionSize = _regionManager->getRegionSize();
+	double edenBytesToCopy = (double)edenRegionCount * _edenSurvivalRateCopyForward * (double)regionSize;
+	double nonEdenBytesToCopy = (double)_nonEdenSurvivalCountCopyForward * (double)regionSize;
+	return _averagePGCOverheadMillis + estimateCopyForwardTimeMillis(edenBytesToCopy + nonEdenBytesToCopy);
+}
+
+UDATA
+MM_SchedulingDelegate::calculateEdenRegionCountForPauseTimeGoal(MM_EnvironmentVLHGC *env) const
+{
+	UDATA edenRegionCount = UDATA_MAX;
+	double targetMillis = (double)_extensions->tarokTargetPauseTimeMillis;
+
+	/* the model is only trusted once a copy-forward PGC has measured the non-copy overhead (and, with it, a real copy rate) */
+	if ((0.0 != targetMillis) && (0.0 != _averagePGCOverheadMillis) && (0.0 != _edenSurvivalRateCopyForward)) {
+		UDATA regionSize = _regionManager->getRegionSize();
+		double copyBudgetMillis = OMR_MAX(targetMillis - _averagePGCOverheadMillis, 0.0);
+		/* reserve time for the non-Eden survivors, but never let them claim more than half of the copy budget since the
+		 * non-Eden part of the collection set is itself trimmed to what remains (see getNonEdenCopyBudgetForPauseTimeGoal)
+		 */
+		double nonEdenCopyMillis = estimateCopyForwardTimeMillis((double)_nonEdenSurvivalCountCopyForward * (double)regionSize);
+		double edenCopyBudgetMillis = copyBudgetMillis - OMR_MIN(nonEdenCopyMillis, copyBudgetMillis / 2.0);
+		double edenCopyBudgetBytes = edenCopyBudgetMillis * 1000.0 * OMR_MAX(_averageCopyForwardRate, 1.0);
+		double edenBytes = edenCopyBudgetBytes / _edenSurvivalRateCopyForward;
+		double maximumEdenBytes = (double)_regionManager->getTableRegionCount() * (double)regionSize;
+		if (edenBytes < maximumEdenBytes) {
+			edenRegionCount = (UDATA)(edenBytes / (double)regionSize);
+		}
+	}
+
+	return edenRegionCount;
+}
+
+UDATA
+MM_SchedulingDelegate::getNonEdenCopyBudgetForPauseTimeGoal(MM_EnvironmentVLHGC *env)
+{
+	UDATA budgetBytes = UDATA_MAX;
+
+	if ((0 != _extensions->tarokTargetPauseTimeMillis) && (0.0 != _averagePGCOverheadMillis)) {
+		double targetMillis = (double)_extensions->tarokTargetPauseTimeMillis;
+		double edenBytesToCopy = (double)getCurrentEdenSizeInBytes(env) * _edenSurvivalRateCopyForward;
+		double remainingMillis = targetMillis - _averagePGCOverheadMillis - estimateCopyForwardTimeMillis(edenBytesToCopy);
+		if (remainingMillis > 0.0) {
+			budgetBytes = (UDATA)(remainingMillis * 1000.0 * OMR_MAX(_averageCopyForwardRate, 1.0));
+		} else {
+			budgetBytes = 0;
+		}
+	}
+
+	return budgetBytes;
+}
+
 UDATA
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC *env) const
 {
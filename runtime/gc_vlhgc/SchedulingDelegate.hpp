@@ -79,6 +79,10 @@ private:
 	U_64 _partialGcStartTime;  /**< Start time of the in progress Partial GC in hi-resolution format (recorded to track total time spent in Partial GC) */
 	U_64 _historicalPartialGCTime;  /**< Weighted historical average of Partial GC times */
 
+	U_64 _copyForwardTimeMicros; /**< Time spent in the copy-forward of the in progress Partial GC, in microseconds (0 if the PGC did not copy-forward) */
+	double _averagePGCOverheadMillis; /**< Weighted average of the Partial GC time not spent in copy-forward (root scanning, card cleaning, remembered set processing), in milliseconds */
+	double _predictedPGCTimeMillis; /**< Pause time predicted for the next Partial GC with the current Eden size, in milliseconds */
+
 	UDATA _dynamicGlobalMarkIncrementTimeMillis;  /**< The dynamically calculated current time to be spent per GMP increment (subject to change over the course of the run) */
 
 	struct MM_SchedulingDelegate_ScanRateStats {
@@ -231,6 +235,30 @@ private:
 	 */
 	void updateGMPStats(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Estimate the time, in milliseconds, a copy-forward would need to copy the given number of bytes at the
+	 * average copy-forward rate.
+	 * @param bytesToCopy[in] The number of bytes expected to survive the copy-forward
+	 * @return the estimated copy time in milliseconds
+	 */
+	double estimateCopyForwardTimeMillis(double bytesToCopy) const;
+
+	/**
+	 * Predict the pause time of a Partial GC for the given Eden size, based on the average copy-forward rate,
+	 * the Eden and non-Eden survival history and the average non-copy overhead of a Partial GC.
+	 * @param edenRegionCount[in] The size of Eden, in regions
+	 * @return the predicted pause time in milliseconds
+	 */
+	double predictPartialGCTimeMillis(UDATA edenRegionCount) const;
+
+	/**
+	 * Calculate the largest Eden, in regions, whose predicted Partial GC pause time meets the pause time goal
+	 * (-Xgc:targetPausetime=). A share of the goal is kept for copying the non-Eden part of the collection set.
+	 * @param env[in] the master GC thread
+	 * @return the maximum Eden region count for the pause time goal (UDATA_MAX if there is no goal or no constraint)
+	 */
+	UDATA calculateEdenRegionCountForPauseTimeGoal(MM_EnvironmentVLHGC *env) const;
+
 	/**
 	 * Called after a copy forward rate to update the averageCopyForwardRate
 	 * @param env[in] the master GC thread
@@ -292,6 +320,14 @@ public:
 	 */
 	U_64 getScanTimeCostPerGMP(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Returns the number of bytes the non-Eden part of the next PGC collection set may copy without exceeding the
+	 * pause time goal (-Xgc:targetPausetime=), given the bytes expected to survive from Eden.
+	 *
+	 * @return the copy budget for non-Eden regions in bytes, or UDATA_MAX if no pause time goal was specified
+	 */
+	UDATA getNonEdenCopyBudgetForPauseTimeGoal(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Return measured average scan rate.
 	 */
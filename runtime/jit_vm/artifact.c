@@ -60,6 +60,7 @@ J9JITHashTable *jit_artifact_add_code_cache(J9PortLibrary * portLibrary, J9AVLTr
 {
 	if(optionalHashTable) {
 		avl_insert(tree, (J9AVLTreeNode *) optionalHashTable);
+		hash_jit_publish_range_index(tree);
 		return optionalHashTable;
 	} else {
 		J9JITHashTable *newTable;
@@ -71,6 +72,7 @@ J9JITHashTable *jit_artifact_add_code_cache(J9PortLibrary * portLibrary, J9AVLTr
 			return NULL;
 
 		avl_insert(tree, (J9AVLTreeNode *) newTable);
+		hash_jit_publish_range_index(tree);
 
 		return newTable;
 	}
@@ -163,6 +163,7 @@
 #define J9ClassDoNotAttemptToSetInitCache 0x1
 #define J9ClassHasIllegalFinalFieldModifications 0x2
 #define J9ClassReusedStatics 0x4
+#define J9ClassHasContendedMonitor 0x100
 
 /* @ddr_namespace: map_to_type=J9FieldFlags */
 
@@ -608,6 +609,18 @@ typedef struct J9JITStackAtlas {
 	U_16 paddingTo32;
 } J9JITStackAtlas;
 
+/* Sorted snapshot of the code cache hash tables in the translation artifact tree,
+ * published through J9AVLTree.userData so that PC lookups can binary search it
+ * without walking the tree. Superseded snapshots are chained through previous and
+ * are only freed when the tree is freed.
+ */
+typedef struct J9JITArtifactRangeIndex {
+	struct J9JITArtifactRangeIndex* previous;
+	UDATA stale;
+	UDATA count;
+	struct J9JITHashTable* tables[1];
+} J9JITArtifactRangeIndex;
+
 typedef struct J9JITDataCacheHeader {
 	U_32 size;
 	U_32 type;
@@ -75,9 +75,34 @@ J9JITExceptionTable* hash_jit_artifact_search(J9JITHashTable *table, UDATA searc
 }
 
 
+static J9JITHashTable* jit_artifact_search_table(J9AVLTree *tree, UDATA searchValue) {
+	/* Binary search the published range index if there is one. Code cache hash tables
+	 * are never removed, so any snapshot read here remains valid for the lookup.
+	 */
+	J9JITArtifactRangeIndex *index = (J9JITArtifactRangeIndex *)tree->userData;
+	if ((NULL != index) && !index->stale) {
+		UDATA low = 0;
+		UDATA high = index->count;
+		while (low < high) {
+			UDATA mid = low + ((high - low) >> 1);
+			J9JITHashTable *table = index->tables[mid];
+			if (searchValue < table->start) {
+				high = mid;
+			} else if (searchValue >= table->end) {
+				low = mid + 1;
+			} else {
+				return table;
+			}
+		}
+		return NULL;
+	}
+	return (J9JITHashTable*)avl_search(tree, searchValue);
+}
+
+
 J9JITExceptionTable* jit_artifact_search(J9AVLTree *tree, UDATA searchValue) {
         /* find the right hash table to look in */
-        J9JITHashTable *table = (J9JITHashTable*)avl_search(tree, searchValue);
+        J9JITHashTable *table = jit_artifact_search_table(tree, searchValue);
         if (table) {
                 /* return the result of looking in the correct hash table */
                 return hash_jit_artifact_search(table, searchValue);
@@ -156,6 +156,20 @@ objectMonitorEnterBlocking(J9VMThread *currentThread)
 		J9ObjectMonitor *objectMonitor = monitorTableAt(currentThread, object);
 		/* Table entry was created by the nonblocking case, so this peek cannot fail */
 		Assert_VM_notNull(objectMonitor);
+		/* Record that instances of this class have been contended so that the JIT
+		 * can avoid optimistic locking optimizations (coarsening, lock reservation).
+		 */
+		{
+			J9Class *objectClass = J9OBJECT_CLAZZ(currentThread, object);
+			U_32 oldFlags = objectClass->classFlags;
+			while (J9_ARE_NO_BITS_SET(oldFlags, J9ClassHasContendedMonitor)) {
+				U_32 const seenFlags = VM_AtomicSupport::lockCompareExchangeU32(&objectClass->classFlags, oldFlags, oldFlags | J9ClassHasContendedMonitor);
+				if (seenFlags == oldFlags) {
+					break;
+				}
+				oldFlags = seenFlags;
+			}
+		}
 		object = NULL; // for safety, since object may be moved by the GC at various points after this
 		/* Ensure object monitor isn't deflated while we block */
 		omrthread_monitor_t monitor = objectMonitor->monitor;
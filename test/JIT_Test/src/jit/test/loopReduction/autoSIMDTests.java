@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.loopReduction;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Loops the SPMD parallelizer can turn into vector loops. Every kernel runs
+ * over lengths that leave 0 to 3 vectors' worth of residue iterations, and the
+ * result of each element is checked against a value computed outside any
+ * loop, so a wrongly vectorized body or residue loop shows up as a mismatch.
+ * Loops with a loop-carried dependence are included to check that they are
+ * left scalar.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class autoSIMDTests
+   {
+   private static final int MAX_LENGTH = 67;
+   private static final int ITERATIONS = 3000;
+
+   static void addInt(int[] a, int[] b, int[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = b[i] + c[i];
+      }
+
+   static void subMulInt(int[] a, int[] b, int[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = (b[i] - c[i]) * b[i];
+      }
+
+   static void addLong(long[] a, long[] b, long[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = b[i] + c[i];
+      }
+
+   static void mulAddFloat(float[] a, float[] b, float[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = b[i] * c[i] + b[i];
+      }
+
+   static void mulDouble(double[] a, double[] b, double[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = b[i] * c[i];
+      }
+
+   static void scaleInt(int[] a, int[] b, int k, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = b[i] * k;
+      }
+
+   static void addByte(byte[] a, byte[] b, byte[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = (byte)(b[i] + c[i]);
+      }
+
+   static void addShort(short[] a, short[] b, short[] c, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i] = (short)(b[i] + c[i]);
+      }
+
+   static void prefixInt(int[] a, int n)
+      {
+      for (int i = 1; i < n; i++)
+         a[i] = a[i - 1] + a[i];
+      }
+
+   static void shiftInt(int[] a, int[] b, int n)
+      {
+      for (int i = 0; i < n; i++)
+         a[i + 1] = b[i] + 1;
+      }
+
+   private static int intValue(int i)
+      {
+      return i * 7919 - 104729;
+      }
+
+   private static int[] intArray(int n, int seed)
+      {
+      int[] a = new int[n + 1];
+      for (int i = 0; i < a.length; i++)
+         a[i] = intValue(i + seed);
+      return a;
+      }
+
+   @Test
+   public void testIntArithmetic()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         int[] b = intArray(n, 1);
+         int[] c = intArray(n, 2);
+         int[] a = new int[n + 1];
+
+         addInt(a, b, c, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("addInt length " + n + " index " + i, intValue(i + 1) + intValue(i + 2), a[i]);
+         AssertJUnit.assertEquals("addInt wrote past the end for length " + n, 0, a[n]);
+
+         subMulInt(a, b, c, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("subMulInt length " + n + " index " + i, (intValue(i + 1) - intValue(i + 2)) * intValue(i + 1), a[i]);
+
+         scaleInt(a, b, -3, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("scaleInt length " + n + " index " + i, intValue(i + 1) * -3, a[i]);
+         }
+      }
+
+   @Test
+   public void testLongArithmetic()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         long[] b = new long[n];
+         long[] c = new long[n];
+         long[] a = new long[n];
+         for (int i = 0; i < n; i++)
+            {
+            b[i] = ((long)intValue(i) << 20) + i;
+            c[i] = Long.MAX_VALUE - i;
+            }
+         addLong(a, b, c, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("addLong length " + n + " index " + i, (((long)intValue(i) << 20) + i) + (Long.MAX_VALUE - i), a[i]);
+         }
+      }
+
+   @Test
+   public void testFloatingPointArithmetic()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         float[] fb = new float[n];
+         float[] fc = new float[n];
+         float[] fa = new float[n];
+         double[] db = new double[n];
+         double[] dc = new double[n];
+         double[] da = new double[n];
+         for (int i = 0; i < n; i++)
+            {
+            fb[i] = i * 0.5f - 3.25f;
+            fc[i] = 1.0f / (i + 1);
+            db[i] = i * 1.75 - 11.0;
+            dc[i] = -1.0 / (i + 3);
+            }
+         mulAddFloat(fa, fb, fc, n);
+         mulDouble(da, db, dc, n);
+         for (int i = 0; i < n; i++)
+            {
+            float fbi = i * 0.5f - 3.25f;
+            float fexpected = fbi * (1.0f / (i + 1)) + fbi;
+            AssertJUnit.assertEquals("mulAddFloat length " + n + " index " + i, Float.floatToIntBits(fexpected), Float.floatToIntBits(fa[i]));
+            double dexpected = (i * 1.75 - 11.0) * (-1.0 / (i + 3));
+            AssertJUnit.assertEquals("mulDouble length " + n + " index " + i, Double.doubleToLongBits(dexpected), Double.doubleToLongBits(da[i]));
+            }
+         }
+      }
+
+   @Test
+   public void testNarrowArithmetic()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         byte[] bb = new byte[n];
+         byte[] bc = new byte[n];
+         byte[] ba = new byte[n];
+         short[] sb = new short[n];
+         short[] sc = new short[n];
+         short[] sa = new short[n];
+         for (int i = 0; i < n; i++)
+            {
+            bb[i] = (byte)(i * 13);
+            bc[i] = (byte)(120 - i);
+            sb[i] = (short)(i * 1031);
+            sc[i] = (short)(32000 - i * 7);
+            }
+         addByte(ba, bb, bc, n);
+         addShort(sa, sb, sc, n);
+         for (int i = 0; i < n; i++)
+            {
+            AssertJUnit.assertEquals("addByte length " + n + " index " + i, (byte)((byte)(i * 13) + (byte)(120 - i)), ba[i]);
+            AssertJUnit.assertEquals("addShort length " + n + " index " + i, (short)((short)(i * 1031) + (short)(32000 - i * 7)), sa[i]);
+            }
+         }
+      }
+
+   @Test
+   public void testLoopCarriedDependence()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         int[] a = new int[n + 1];
+         for (int i = 0; i < n; i++)
+            a[i] = i + 1;
+         prefixInt(a, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("prefixInt length " + n + " index " + i, (i + 1) * (i + 2) / 2, a[i]);
+
+         // the same array as source and destination, one element apart
+         for (int i = 0; i <= n; i++)
+            a[i] = 0;
+         shiftInt(a, a, n);
+         for (int i = 1; i <= n; i++)
+            AssertJUnit.assertEquals("shiftInt length " + n + " index " + i, i, a[i]);
+         }
+      }
+
+   @Test
+   public void testAliasedOperands()
+      {
+      for (int iter = 0; iter < ITERATIONS; iter++)
+         {
+         int n = iter % (MAX_LENGTH + 1);
+         int[] a = intArray(n, 5);
+         addInt(a, a, a, n);
+         for (int i = 0; i < n; i++)
+            AssertJUnit.assertEquals("addInt in place length " + n + " index " + i, intValue(i + 5) * 2, a[i]);
+         }
+      }
+   }
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.tr.crc32;
+
+import java.util.zip.CRC32;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Checks CRC32.update(byte[], int, int) against a table-driven reference for
+ * lengths on both sides of the 16 and 64 byte folding steps of the
+ * accelerated routine, and for offsets that leave the data unaligned.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class CRC32Tests
+   {
+   private static final int MAX_LENGTH = 300;
+   private static final int MAX_OFFSET = 17;
+   private static final int WARMUP_ITERATIONS = 2000;
+
+   private static final int[] TABLE = new int[256];
+
+   static
+      {
+      for (int n = 0; n < 256; n++)
+         {
+         int c = n;
+         for (int k = 0; k < 8; k++)
+            c = ((c & 1) != 0) ? (0xEDB88320 ^ (c >>> 1)) : (c >>> 1);
+         TABLE[n] = c;
+         }
+      }
+
+   private static long referenceCRC(long crc, byte[] b, int off, int len)
+      {
+      int c = ~(int)crc;
+      for (int i = off; i < off + len; i++)
+         c = TABLE[(c ^ b[i]) & 0xff] ^ (c >>> 8);
+      return (~c) & 0xFFFFFFFFL;
+      }
+
+   private static byte[] createData(int size)
+      {
+      byte[] data = new byte[size];
+      for (int i = 0; i < size; i++)
+         data[i] = (byte)(i * 31 + (i >>> 3) + 7);
+      return data;
+      }
+
+   private static long crcOf(byte[] b, int off, int len)
+      {
+      CRC32 crc = new CRC32();
+      crc.update(b, off, len);
+      return crc.getValue();
+      }
+
+   private static long crcOfInPieces(byte[] b, int off, int len, int piece)
+      {
+      CRC32 crc = new CRC32();
+      for (int i = off; i < off + len; i += piece)
+         crc.update(b, i, Math.min(piece, off + len - i));
+      return crc.getValue();
+      }
+
+   private static void checkAllLengthsAndOffsets(byte[] data)
+      {
+      for (int off = 0; off <= MAX_OFFSET; off++)
+         {
+         for (int len = 0; len <= MAX_LENGTH; len++)
+            {
+            long expected = referenceCRC(0, data, off, len);
+            long actual = crcOf(data, off, len);
+            if (expected != actual)
+               AssertJUnit.fail("CRC32 mismatch for offset " + off + " length " + len +
+                     ": expected " + Long.toHexString(expected) + " got " + Long.toHexString(actual));
+            }
+         }
+      }
+
+   @Test
+   public void testLengthsAndOffsets()
+      {
+      byte[] data = createData(MAX_OFFSET + MAX_LENGTH + 1);
+      // run the checks often enough for the callers of update to be compiled
+      for (int i = 0; i < WARMUP_ITERATIONS / 100; i++)
+         checkAllLengthsAndOffsets(data);
+      }
+
+   @Test
+   public void testChainedUpdates()
+      {
+      byte[] data = createData(4096 + MAX_OFFSET);
+      for (int iter = 0; iter < WARMUP_ITERATIONS; iter++)
+         {
+         int off = iter % MAX_OFFSET;
+         int piece = 1 + (iter % 97);
+         long expected = referenceCRC(0, data, off, 4096);
+         long actual = crcOfInPieces(data, off, 4096, piece);
+         AssertJUnit.assertEquals("CRC32 mismatch for offset " + off + " piece size " + piece, expected, actual);
+         }
+      }
+
+   @Test
+   public void testEmptyUpdateKeepsValue()
+      {
+      byte[] data = createData(128);
+      for (int iter = 0; iter < WARMUP_ITERATIONS; iter++)
+         {
+         CRC32 crc = new CRC32();
+         crc.update(data, 3, 61);
+         long before = crc.getValue();
+         crc.update(data, 64, 0);
+         crc.update(data, data.length, 0);
+         AssertJUnit.assertEquals(before, crc.getValue());
+         AssertJUnit.assertEquals(referenceCRC(0, data, 3, 61), before);
+         }
+      }
+
+   @Test
+   public void testOutOfBounds()
+      {
+      byte[] data = createData(64);
+      CRC32 crc = new CRC32();
+      try
+         {
+         crc.update(data, 1, 64);
+         AssertJUnit.fail("ArrayIndexOutOfBoundsException expected");
+         }
+      catch (ArrayIndexOutOfBoundsException e)
+         {
+         }
+      }
+   }
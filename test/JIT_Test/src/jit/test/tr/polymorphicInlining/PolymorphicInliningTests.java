@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.tr.polymorphicInlining;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Virtual and interface call sites that see two or three receiver types.
+ * Run with -Xjit:maxPolymorphicProfiledTargets so that each profiled receiver
+ * is inlined behind its own guard; the results must not depend on which
+ * guard a receiver takes, and a receiver the profile never saw must still be
+ * dispatched correctly.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class PolymorphicInliningTests
+   {
+   private static final int ITERATIONS = 200000;
+
+   static abstract class Shape
+      {
+      abstract int area(int scale);
+      }
+
+   static final class Square extends Shape
+      {
+      int area(int scale) { return scale * scale; }
+      }
+
+   static final class Rectangle extends Shape
+      {
+      int area(int scale) { return scale * (scale + 1); }
+      }
+
+   static final class Triangle extends Shape
+      {
+      int area(int scale) { return scale * scale / 2; }
+      }
+
+   static final class Line extends Shape
+      {
+      int area(int scale) { return 0; }
+      }
+
+   interface Visitor
+      {
+      long visit(long value);
+      }
+
+   static final class AddVisitor implements Visitor
+      {
+      public long visit(long value) { return value + 3; }
+      }
+
+   static final class MulVisitor implements Visitor
+      {
+      public long visit(long value) { return value * 5; }
+      }
+
+   static final class XorVisitor implements Visitor
+      {
+      public long visit(long value) { return value ^ 0x55; }
+      }
+
+   static int virtualSite(Shape shape, int scale)
+      {
+      return shape.area(scale);
+      }
+
+   static long interfaceSite(Visitor visitor, long value)
+      {
+      return visitor.visit(value);
+      }
+
+   private static int expectedArea(int kind, int scale)
+      {
+      switch (kind)
+         {
+         case 0: return scale * scale;
+         case 1: return scale * (scale + 1);
+         case 2: return scale * scale / 2;
+         default: return 0;
+         }
+      }
+
+   private static long expectedVisit(int kind, long value)
+      {
+      switch (kind)
+         {
+         case 0: return value + 3;
+         case 1: return value * 5;
+         default: return value ^ 0x55;
+         }
+      }
+
+   private static void checkVirtualSite(Shape[] shapes, int numReceivers)
+      {
+      for (int i = 0; i < ITERATIONS; i++)
+         {
+         int kind = i % numReceivers;
+         int scale = i & 0xff;
+         AssertJUnit.assertEquals("area of receiver " + kind + " at iteration " + i, expectedArea(kind, scale), virtualSite(shapes[kind], scale));
+         }
+      }
+
+   @Test
+   public void testTwoReceiverVirtualSite()
+      {
+      checkVirtualSite(new Shape[] { new Square(), new Rectangle() }, 2);
+      }
+
+   @Test
+   public void testThreeReceiverVirtualSite()
+      {
+      checkVirtualSite(new Shape[] { new Square(), new Rectangle(), new Triangle() }, 3);
+      }
+
+   @Test
+   public void testSkewedThreeReceiverVirtualSite()
+      {
+      Shape[] shapes = new Shape[] { new Square(), new Rectangle(), new Triangle() };
+      for (int i = 0; i < ITERATIONS; i++)
+         {
+         // 80% / 15% / 5%, so the least frequent receiver is only inlined as part of a bounded-polymorphic site
+         int r = i % 20;
+         int kind = r < 16 ? 0 : (r < 19 ? 1 : 2);
+         int scale = i & 0xff;
+         AssertJUnit.assertEquals("area of receiver " + kind + " at iteration " + i, expectedArea(kind, scale), virtualSite(shapes[kind], scale));
+         }
+      }
+
+   @Test
+   public void testUnprofiledReceiverAfterWarmup()
+      {
+      Shape[] shapes = new Shape[] { new Square(), new Rectangle(), new Triangle(), new Line() };
+      checkVirtualSite(shapes, 3);
+      for (int i = 0; i < 1000; i++)
+         {
+         int kind = i % 4;
+         AssertJUnit.assertEquals("area of receiver " + kind + " after warmup", expectedArea(kind, i), virtualSite(shapes[kind], i));
+         }
+      }
+
+   @Test
+   public void testThreeReceiverInterfaceSite()
+      {
+      Visitor[] visitors = new Visitor[] { new AddVisitor(), new MulVisitor(), new XorVisitor() };
+      for (int i = 0; i < ITERATIONS; i++)
+         {
+         int kind = i % 3;
+         long value = ((long)i << 17) - i;
+         AssertJUnit.assertEquals("visit of receiver " + kind + " at iteration " + i, expectedVisit(kind, value), interfaceSite(visitors[kind], value));
+         }
+      }
+   }
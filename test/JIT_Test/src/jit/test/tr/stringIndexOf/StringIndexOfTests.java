@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.tr.stringIndexOf;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Checks String.indexOf(int) and String.indexOf(int, int) on Latin-1 strings,
+ * which are stored compressed when string compression is enabled, and on
+ * strings holding a character above 0xFF, which are always stored
+ * decompressed. Matches are placed at the start, at the end, and on either
+ * side of the 16 byte blocks the accelerated search works in.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class StringIndexOfTests
+   {
+   private static final int MAX_LENGTH = 70;
+   private static final int WARMUP_ITERATIONS = 200;
+
+   private static final char FILL_COMPRESSED = 'a';
+   private static final char MATCH_COMPRESSED = 'z';
+   private static final char FILL_DECOMPRESSED = '\u0101';
+   private static final char MATCH_DECOMPRESSED = '\u4E2D';
+
+   private static int referenceIndexOf(String s, int ch, int fromIndex)
+      {
+      for (int i = Math.max(fromIndex, 0); i < s.length(); i++)
+         {
+         if (s.charAt(i) == ch)
+            return i;
+         }
+      return -1;
+      }
+
+   private static String createString(int length, char fill, char match, int matchIndex)
+      {
+      char[] chars = new char[length];
+      for (int i = 0; i < length; i++)
+         chars[i] = fill;
+      if (matchIndex >= 0)
+         chars[matchIndex] = match;
+      return new String(chars);
+      }
+
+   private static void check(String s, int ch, int fromIndex)
+      {
+      int expected = referenceIndexOf(s, ch, fromIndex);
+      int actual = s.indexOf(ch, fromIndex);
+      if (expected != actual)
+         AssertJUnit.fail("indexOf(0x" + Integer.toHexString(ch) + ", " + fromIndex + ") on a string of length " + s.length() +
+               ": expected " + expected + " got " + actual);
+      }
+
+   private static void checkAllPositions(char fill, char match)
+      {
+      for (int length = 0; length <= MAX_LENGTH; length++)
+         {
+         // no match at all
+         String s = createString(length, fill, match, -1);
+         check(s, match, 0);
+         AssertJUnit.assertEquals(referenceIndexOf(s, match, 0), s.indexOf(match));
+
+         for (int matchIndex = 0; matchIndex < length; matchIndex++)
+            {
+            s = createString(length, fill, match, matchIndex);
+            AssertJUnit.assertEquals(matchIndex, s.indexOf(match));
+            check(s, match, 0);
+            check(s, match, -5);
+            check(s, match, matchIndex);
+            check(s, match, matchIndex + 1);
+            check(s, match, length);
+            check(s, match, length + 3);
+            // start the search inside and at the edges of a 16 byte block
+            for (int fromIndex = 1; fromIndex <= 17 && fromIndex < length; fromIndex += 7)
+               check(s, match, fromIndex);
+            }
+         }
+      }
+
+   @Test
+   public void testCompressed()
+      {
+      for (int i = 0; i < WARMUP_ITERATIONS; i++)
+         checkAllPositions(FILL_COMPRESSED, MATCH_COMPRESSED);
+      }
+
+   @Test
+   public void testDecompressed()
+      {
+      for (int i = 0; i < WARMUP_ITERATIONS; i++)
+         checkAllPositions(FILL_DECOMPRESSED, MATCH_DECOMPRESSED);
+      }
+
+   @Test
+   public void testDecompressedLatin1Match()
+      {
+      // a Latin-1 character searched for in a decompressed string
+      for (int i = 0; i < WARMUP_ITERATIONS; i++)
+         checkAllPositions(FILL_DECOMPRESSED, MATCH_COMPRESSED);
+      }
+
+   @Test
+   public void testCharacterOutsideCompressedRange()
+      {
+      for (int iter = 0; iter < WARMUP_ITERATIONS * 10; iter++)
+         {
+         for (int length = 0; length <= MAX_LENGTH; length += 5)
+            {
+            String s = createString(length, FILL_COMPRESSED, MATCH_COMPRESSED, length / 2);
+            // only the low byte of these characters matches the string content
+            check(s, FILL_COMPRESSED | 0x100, 0);
+            check(s, MATCH_COMPRESSED | 0x4200, 0);
+            check(s, 0x10000 | MATCH_COMPRESSED, 0);
+            check(s, -1, 0);
+            }
+         }
+      }
+
+   @Test
+   public void testSupplementaryCharacter()
+      {
+      String s = "abc" + new String(Character.toChars(0x1F600)) + "def";
+      for (int iter = 0; iter < WARMUP_ITERATIONS * 10; iter++)
+         {
+         AssertJUnit.assertEquals(3, s.indexOf(0x1F600));
+         AssertJUnit.assertEquals(-1, s.indexOf(0x1F600, 4));
+         AssertJUnit.assertEquals(6, s.indexOf('e'));
+         }
+      }
+   }